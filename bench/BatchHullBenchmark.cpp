@@ -0,0 +1,94 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "BatchHull/BatchConvexHull/BatchConvexHull.h"
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+using namespace std;
+using namespace std::chrono;
+
+int main() {
+    using T = double;
+
+    vector<size_t> cloud_counts = {10000, 100000, 1000000};
+    size_t minCloudSize = 5;
+    size_t maxCloudSize = 50;
+    size_t numThreads = max(1u, thread::hardware_concurrency());
+
+    MonotoneChainAlgorithm<T> monotoneChain;
+    AConvexHullStrategy<T>& strategy = monotoneChain;
+    BatchConvexHull<T> sequentialBatch;
+    BatchConvexHull<T> parallelBatch(numThreads);
+
+    ofstream csv("batch_hull_benchmark.csv");
+    csv << "Objects,Points,Threads,PerObject_Objects_per_s,Batch_Objects_per_s,Parallel_Objects_per_s,"
+        << "Batch_Speedup,Parallel_Speedup,Results_Match\n";
+
+    cout << "=== BATCHED HULLS OF SMALL CLOUDS vs ONE apply() PER OBJECT ===\n";
+
+    mt19937 gen(42);
+    uniform_int_distribution<size_t> cloudSize(minCloudSize, maxCloudSize);
+    uniform_real_distribution<T> coordinate(0.0, 100.0);
+
+    for (size_t numClouds : cloud_counts) {
+        vector<Point<T>> points;
+        vector<size_t> offsets = {0};
+        for (size_t c = 0; c < numClouds; ++c) {
+            size_t n = cloudSize(gen);
+            for (size_t i = 0; i < n; ++i) {
+                points.emplace_back(coordinate(gen), coordinate(gen));
+            }
+            offsets.push_back(points.size());
+        }
+
+        // Today's path: a vector per object and a virtual apply() returning a Poligon
+        size_t perObjectVertexes = 0;
+        auto start = high_resolution_clock::now();
+        for (size_t c = 0; c < numClouds; ++c) {
+            vector<Point<T>> cloud(points.begin() + offsets[c], points.begin() + offsets[c + 1]);
+            perObjectVertexes += strategy.apply(cloud).numVertexes();
+        }
+        auto end = high_resolution_clock::now();
+        double perObjectSeconds = duration_cast<nanoseconds>(end - start).count() / 1e9;
+
+        vector<Point<T>> hulls;
+        vector<size_t> hullOffsets;
+        start = high_resolution_clock::now();
+        sequentialBatch.apply(points, offsets, hulls, hullOffsets);
+        end = high_resolution_clock::now();
+        double batchSeconds = duration_cast<nanoseconds>(end - start).count() / 1e9;
+        bool resultsMatch = hulls.size() == perObjectVertexes;
+
+        start = high_resolution_clock::now();
+        parallelBatch.apply(points, offsets, hulls, hullOffsets);
+        end = high_resolution_clock::now();
+        double parallelSeconds = duration_cast<nanoseconds>(end - start).count() / 1e9;
+        resultsMatch = resultsMatch && hulls.size() == perObjectVertexes;
+
+        double perObjectRate = numClouds / perObjectSeconds;
+        double batchRate = numClouds / batchSeconds;
+        double parallelRate = numClouds / parallelSeconds;
+
+        csv << numClouds << "," << points.size() << "," << numThreads << "," << fixed << setprecision(0)
+            << perObjectRate << "," << batchRate << "," << parallelRate << "," << setprecision(3)
+            << batchRate / perObjectRate << "," << parallelRate / perObjectRate << ","
+            << (resultsMatch ? "Yes" : "No") << "\n";
+
+        cout << "  " << numClouds << " objects: " << fixed << setprecision(0) << perObjectRate
+             << " obj/s per object, " << batchRate << " obj/s batched, " << parallelRate << " obj/s on "
+             << numThreads << " threads (" << setprecision(2) << batchRate / perObjectRate << "x, "
+             << parallelRate / perObjectRate << "x), Match: " << (resultsMatch ? "Yes" : "No") << "\n";
+    }
+
+    csv.close();
+    cout << "Generated: batch_hull_benchmark.csv\n";
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "DynamicHull/DynamicConvexHull/DynamicConvexHull.h"
+#include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "PointGenerationStrategy/RandomPointStrategy/RandomPointStrategy.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// Each update replaces a random live point with a fresh one: one erase plus one insert
+struct Update {
+    size_t eraseIndex;
+    Point<double> inserted;
+};
+
+template<typename T>
+bool sameVertexes(const Poligon<T>& a, const Poligon<T>& b) {
+    if (a.numVertexes() != b.numVertexes()) return false;
+    for (size_t i = 0; i < a.numVertexes(); ++i) {
+        if (!(a[i] == b[i])) return false;
+    }
+    return true;
+}
+
+int main() {
+    using T = double;
+    
+    vector<size_t> point_counts = {1000, 10000, 100000};
+    size_t updates = 10000;
+    
+    RandomPointGenerator<T> randomGen;
+    DivideAndConquerAlgorithm<T> divideConquer;
+    mt19937 gen(42);
+    
+    ofstream csv("dynamic_hull_benchmark.csv");
+    csv << "Points,Updates,Dynamic_Update_us,Dynamic_Update_Snapshot_us,Recompute_Updates,Recompute_Update_us,Speedup,Results_Match\n";
+    
+    cout << "=== DYNAMIC HULL vs DIVIDE & CONQUER RECOMPUTATION ===\n";
+    
+    for (size_t n : point_counts) {
+        vector<Point<T>> initial = randomGen.generate(n);
+        vector<Point<T>> fresh = randomGen.generate(updates);
+        vector<Update> script;
+        for (size_t i = 0; i < updates; ++i) {
+            script.push_back({gen() % n, fresh[i]});
+        }
+        
+        // Dynamic structure: updates alone, then updates with a snapshot after each one
+        DynamicConvexHull<T> dynamicHull;
+        for (const Point<T>& point : initial) {
+            dynamicHull.insert(point);
+        }
+        vector<Point<T>> live = initial;
+        
+        auto start = high_resolution_clock::now();
+        for (const Update& update : script) {
+            dynamicHull.erase(live[update.eraseIndex]);
+            dynamicHull.insert(update.inserted);
+            live[update.eraseIndex] = update.inserted;
+        }
+        auto end = high_resolution_clock::now();
+        double dynamicUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / updates;
+        
+        start = high_resolution_clock::now();
+        for (const Update& update : script) {
+            dynamicHull.erase(live[update.eraseIndex]);
+            dynamicHull.insert(update.inserted);
+            live[update.eraseIndex] = update.inserted;
+            dynamicHull.hull();
+        }
+        end = high_resolution_clock::now();
+        double snapshotUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / updates;
+        bool resultsMatch = sameVertexes(dynamicHull.hull(), divideConquer.apply(live));
+        
+        // Full recomputation after every update; capped so the largest sizes finish
+        size_t recomputeUpdates = max<size_t>(10, min<size_t>(updates, 10000000 / n));
+        vector<Point<T>> cloud = initial;
+        start = high_resolution_clock::now();
+        for (size_t i = 0; i < recomputeUpdates; ++i) {
+            cloud[script[i].eraseIndex] = script[i].inserted;
+            divideConquer.apply(cloud);
+        }
+        end = high_resolution_clock::now();
+        double recomputeUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / recomputeUpdates;
+        double speedup = (snapshotUs > 0) ? recomputeUs / snapshotUs : 0.0;
+        
+        csv << n << "," << updates << "," << fixed << setprecision(3)
+            << dynamicUs << "," << snapshotUs << "," << recomputeUpdates << ","
+            << recomputeUs << "," << speedup << "," << (resultsMatch ? "Yes" : "No") << "\n";
+        
+        cout << "  " << n << " points: dynamic " << fixed << setprecision(3) << dynamicUs
+             << "us/update (" << (1e6 / dynamicUs) << " updates/s), with snapshot " << snapshotUs
+             << "us, D&C recompute " << recomputeUs << "us/update, speedup " << speedup
+             << "x, Match: " << (resultsMatch ? "Yes" : "No") << "\n";
+    }
+    
+    csv.close();
+    cout << "Generated: dynamic_hull_benchmark.csv\n";
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cmath>
+#include "Point/Point.h"
+#include "Vector/Vector.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// Accessors behind a call boundary the compiler cannot see through, which is what every
+// getX() and getY() cost while Point and Vector were compiled in their own translation units
+template<typename T>
+T pointX(const Point<T>& p) { return p.getX(); }
+
+template<typename T>
+T pointY(const Point<T>& p) { return p.getY(); }
+
+template<typename T>
+T (*volatile outOfLineX)(const Point<T>&) = &pointX<T>;
+
+template<typename T>
+T (*volatile outOfLineY)(const Point<T>&) = &pointY<T>;
+
+template<typename F>
+double nanosecondsPerOp(size_t ops, int rounds, F&& body) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        auto start = high_resolution_clock::now();
+        body();
+        auto end = high_resolution_clock::now();
+        best = min(best, duration_cast<nanoseconds>(end - start).count() / double(ops));
+    }
+    return best;
+}
+
+template<typename T>
+void runKernels(const string& typeName, size_t n, ofstream& csv) {
+    mt19937 gen(42);
+    uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    // Consecutive points of a circle always turn left, so the loops measure the kernel and
+    // not branch mispredictions
+    vector<Point<T>> points;
+    vector<Vector<T>> vectors;
+    for (size_t i = 0; i < n; ++i) {
+        double angle = 6.283185307179586 * i / n;
+        points.emplace_back(T(1e6 * cos(angle)), T(1e6 * sin(angle)));
+        vectors.emplace_back(T(coordinate(gen)), T(coordinate(gen)));
+    }
+
+    const int rounds = 5;
+    volatile long long sink = 0;
+
+    // Turns of consecutive triples, the inner loop of every chain and wrap
+    auto turns = [&](auto orientation) {
+        long long left = 0;
+        for (size_t i = 0; i + 2 < n; ++i) {
+            left += orientation(points[i], points[i + 1], points[i + 2]) == Orientation::COUNTERCLOCKWISE;
+        }
+        sink = sink + left;
+    };
+    double orientationInline = nanosecondsPerOp(n - 2, rounds, [&]() {
+        turns([](const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+            return OrientationPredicate<T>::orientation(a, b, c);
+        });
+    });
+    double orientationOutOfLine = nanosecondsPerOp(n - 2, rounds, [&]() {
+        turns([](const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+            return OrientationPredicate<T>::toOrientation(OrientationPredicate<T>::sign(
+                outOfLineX<T>(a), outOfLineY<T>(a), outOfLineX<T>(b), outOfLineY<T>(b),
+                outOfLineX<T>(c), outOfLineY<T>(c)));
+        });
+    });
+
+    auto crosses = [&](auto cross) {
+        T total = 0;
+        for (size_t i = 0; i + 1 < n; ++i) {
+            total += cross(vectors[i], vectors[i + 1]);
+        }
+        sink = sink + static_cast<long long>(total);
+    };
+    double crossInline = nanosecondsPerOp(n - 1, rounds, [&]() {
+        crosses([](const Vector<T>& a, const Vector<T>& b) { return a.cross(b).getZ(); });
+    });
+    double crossOutOfLine = nanosecondsPerOp(n - 1, rounds, [&]() {
+        crosses([](const Vector<T>& a, const Vector<T>& b) {
+            Point<T> p(a.getX(), a.getY());
+            Point<T> q(b.getX(), b.getY());
+            return outOfLineX<T>(p) * outOfLineY<T>(q) - outOfLineY<T>(p) * outOfLineX<T>(q);
+        });
+    });
+
+    struct Row { const char* kernel; double inlined; double outOfLine; };
+    for (const Row& row : {Row{"orientation", orientationInline, orientationOutOfLine},
+                           Row{"cross", crossInline, crossOutOfLine}}) {
+        csv << row.kernel << "," << typeName << "," << n << "," << fixed << setprecision(3)
+            << row.inlined << "," << row.outOfLine << "," << row.outOfLine / row.inlined << "\n";
+        cout << "  " << setw(12) << left << row.kernel << setw(7) << typeName << right << fixed
+             << setprecision(2) << row.inlined << " ns/op inline, " << row.outOfLine << " ns/op behind a call ("
+             << row.outOfLine / row.inlined << "x)\n";
+    }
+}
+
+int main() {
+    size_t n = 1 << 22;
+
+    ofstream csv("geometry_kernel_benchmark.csv");
+    csv << "Kernel,Type,Points,Inline_ns_per_op,OutOfLine_ns_per_op,Speedup\n";
+
+    cout << "=== HEADER-ONLY POINT AND VECTOR KERNELS vs THE SAME KERNELS BEHIND A CALL ===\n";
+    runKernels<double>("double", n, csv);
+    runKernels<float>("float", n, csv);
+    runKernels<int>("int", n, csv);
+
+    csv.close();
+    cout << "Generated: geometry_kernel_benchmark.csv\n";
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <cmath>
+#include <algorithm>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "PointCloud/PointCloud.h"
+#include "PointLocation/ConvexPolygonLocator/ConvexPolygonLocator.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// What callers wrote before the locator: every edge of the hull for every query
+template<typename T>
+PointLocation linearScan(const Poligon<T>& hull, T x, T y) {
+    size_t h = hull.numVertexes();
+    bool onEdge = false;
+    for (size_t i = 0; i < h; ++i) {
+        const Point<T>& a = hull[i];
+        const Point<T>& b = hull[(i + 1) % h];
+        int turn = OrientationPredicate<T>::sign(a.getX(), a.getY(), b.getX(), b.getY(), x, y);
+        if (turn < 0) return PointLocation::OUTSIDE;
+        onEdge = onEdge || turn == 0;
+    }
+    return onEdge ? PointLocation::BOUNDARY : PointLocation::INSIDE;
+}
+
+template<typename F>
+double pointsPerSecond(size_t count, F&& body) {
+    auto start = high_resolution_clock::now();
+    body();
+    auto end = high_resolution_clock::now();
+    return count / (duration_cast<nanoseconds>(end - start).count() / 1e9);
+}
+
+int main() {
+    using T = double;
+
+    vector<size_t> hull_sizes = {16, 256, 4096};
+    size_t numQueries = 4000000;
+    size_t numThreads = max(1u, thread::hardware_concurrency());
+
+    ofstream csv("point_location_benchmark.csv");
+    csv << "Hull_Vertexes,Queries,Threads,Linear_Points_per_s,Locate_Points_per_s,Batch_Points_per_s,"
+        << "Parallel_Points_per_s,Batch_Speedup,Results_Match\n";
+
+    cout << "=== CONVEX POLYGON CONTAINMENT: WEDGE SEARCH vs LINEAR EDGE SCAN ===\n";
+
+    mt19937 gen(42);
+    uniform_real_distribution<T> coordinate(-1.2, 1.2);
+    PointCloud<T> queries;
+    queries.resize(numQueries);
+    for (size_t i = 0; i < numQueries; ++i) {
+        queries.xs()[i] = coordinate(gen);
+        queries.ys()[i] = coordinate(gen);
+    }
+    const T* qx = queries.xs();
+    const T* qy = queries.ys();
+
+    for (size_t h : hull_sizes) {
+        vector<Point<T>> circle;
+        for (size_t i = 0; i < h; ++i) {
+            double angle = 6.283185307179586 * i / h;
+            circle.emplace_back(cos(angle), sin(angle));
+        }
+        Poligon<T> hull = MonotoneChainAlgorithm<T>().apply(circle);
+        ConvexPolygonLocator<T> sequential(hull);
+        ConvexPolygonLocator<T> parallel(hull, numThreads);
+
+        // The linear scan is O(h) per query, so it sees a sample on large hulls
+        size_t linearCount = min(numQueries, numQueries * 16 / h);
+        vector<PointLocation> expected(linearCount);
+        double linearRate = pointsPerSecond(linearCount, [&]() {
+            for (size_t i = 0; i < linearCount; ++i) {
+                expected[i] = linearScan(hull, qx[i], qy[i]);
+            }
+        });
+
+        vector<PointLocation> single(numQueries);
+        double locateRate = pointsPerSecond(numQueries, [&]() {
+            for (size_t i = 0; i < numQueries; ++i) {
+                single[i] = sequential.locate(Point<T>(qx[i], qy[i]));
+            }
+        });
+
+        vector<PointLocation> batched;
+        double batchRate = pointsPerSecond(numQueries, [&]() { sequential.locate(queries, batched); });
+
+        vector<PointLocation> threaded;
+        double parallelRate = pointsPerSecond(numQueries, [&]() { parallel.locate(queries, threaded); });
+
+        bool resultsMatch = batched == single && threaded == single &&
+                            equal(expected.begin(), expected.end(), single.begin());
+
+        csv << h << "," << numQueries << "," << numThreads << "," << fixed << setprecision(0) << linearRate << ","
+            << locateRate << "," << batchRate << "," << parallelRate << "," << setprecision(3)
+            << batchRate / linearRate << "," << (resultsMatch ? "Yes" : "No") << "\n";
+
+        cout << "  h = " << h << ": " << fixed << setprecision(1) << linearRate / 1e6 << " M/s linear, "
+             << locateRate / 1e6 << " M/s locate(), " << batchRate / 1e6 << " M/s batched, "
+             << parallelRate / 1e6 << " M/s on " << numThreads << " threads (" << setprecision(2)
+             << batchRate / linearRate << "x), Match: " << (resultsMatch ? "Yes" : "No") << "\n";
+    }
+
+    csv.close();
+    cout << "Generated: point_location_benchmark.csv\n";
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "HullMeasures/RotatingCalipers/RotatingCalipers.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+using namespace std;
+using namespace std::chrono;
+
+struct Measures {
+    double diameter;
+    double width;
+    double area;
+    double perimeter;
+};
+
+// What runs downstream today: every pair for the diameter, every vertex against every edge
+// for the width and both rectangles
+template<typename T>
+Measures bruteForce(const Poligon<T>& hull) {
+    using Predicate = OrientationPredicate<T>;
+    size_t h = hull.numVertexes();
+    double squaredDiameter = 0.0;
+    for (size_t i = 0; i < h; ++i) {
+        for (size_t j = i + 1; j < h; ++j) {
+            squaredDiameter = max(squaredDiameter, double(Predicate::squaredDistance(hull[i], hull[j])));
+        }
+    }
+    Measures result{sqrt(squaredDiameter), 0.0, 0.0, 0.0};
+    for (size_t i = 0; i < h; ++i) {
+        const Point<T>& a = hull[i];
+        const Point<T>& b = hull[(i + 1) % h];
+        double length = sqrt(double(Predicate::squaredDistance(a, b)));
+        double height = 0.0, low = 0.0, high = 0.0;
+        for (size_t j = 0; j < h; ++j) {
+            height = max(height, double(Predicate::cross(a, b, hull[j])) / length);
+            low = min(low, double(Predicate::dot(a, b, hull[j])) / length);
+            high = max(high, double(Predicate::dot(a, b, hull[j])) / length);
+        }
+        double area = (high - low) * height;
+        double perimeter = 2.0 * (high - low + height);
+        result.width = i == 0 ? height : min(result.width, height);
+        result.area = i == 0 ? area : min(result.area, area);
+        result.perimeter = i == 0 ? perimeter : min(result.perimeter, perimeter);
+    }
+    return result;
+}
+
+template<typename T>
+Measures calipers(const Poligon<T>& hull) {
+    return {RotatingCalipers<T>::diameter(hull).length(), RotatingCalipers<T>::width(hull).width,
+            RotatingCalipers<T>::minimumAreaRectangle(hull).area,
+            RotatingCalipers<T>::minimumPerimeterRectangle(hull).perimeter};
+}
+
+template<typename F>
+double microsecondsPerHull(size_t rounds, F&& body) {
+    auto start = high_resolution_clock::now();
+    for (size_t round = 0; round < rounds; ++round) {
+        body();
+    }
+    auto end = high_resolution_clock::now();
+    return duration_cast<nanoseconds>(end - start).count() / 1e3 / rounds;
+}
+
+bool close(double a, double b) {
+    return abs(a - b) <= 1e-9 * max(1.0, abs(b));
+}
+
+int main() {
+    using T = double;
+
+    vector<size_t> hull_sizes = {16, 128, 1024, 8192};
+
+    ofstream csv("rotating_calipers_benchmark.csv");
+    csv << "Hull_Vertexes,BruteForce_us_per_Hull,Calipers_us_per_Hull,Speedup,Results_Match\n";
+
+    cout << "=== HULL MEASURES: ROTATING CALIPERS vs ALL PAIRS ===\n";
+
+    mt19937 gen(42);
+    uniform_real_distribution<T> angleJitter(0.0, 1.0);
+    uniform_real_distribution<T> axis(0.3, 1.0);
+
+    for (size_t h : hull_sizes) {
+        // Vertices of a random ellipse, so no two edges share a direction
+        T a = axis(gen), b = axis(gen), tilt = angleJitter(gen);
+        vector<Point<T>> ellipse;
+        for (size_t i = 0; i < h; ++i) {
+            double angle = 6.283185307179586 * (i + 0.5 * angleJitter(gen)) / h;
+            T x = a * cos(angle), y = b * sin(angle);
+            ellipse.emplace_back(x * cos(tilt) - y * sin(tilt), x * sin(tilt) + y * cos(tilt));
+        }
+        Poligon<T> hull = MonotoneChainAlgorithm<T>().apply(ellipse);
+
+        // Keep every row near the same total work
+        size_t bruteRounds = max<size_t>(1, 4000000 / (h * h));
+        size_t calipersRounds = max<size_t>(1, 40000000 / (h * 8));
+
+        Measures expected{}, measured{};
+        double bruteTime = microsecondsPerHull(bruteRounds, [&]() { expected = bruteForce(hull); });
+        double calipersTime = microsecondsPerHull(calipersRounds, [&]() { measured = calipers(hull); });
+
+        bool resultsMatch = close(measured.diameter, expected.diameter) && close(measured.width, expected.width) &&
+                            close(measured.area, expected.area) && close(measured.perimeter, expected.perimeter);
+
+        csv << hull.numVertexes() << "," << fixed << setprecision(3) << bruteTime << "," << calipersTime << ","
+            << bruteTime / calipersTime << "," << (resultsMatch ? "Yes" : "No") << "\n";
+
+        cout << "  h = " << hull.numVertexes() << ": " << fixed << setprecision(2) << bruteTime << " us brute force, "
+             << calipersTime << " us calipers (" << bruteTime / calipersTime << "x), Match: "
+             << (resultsMatch ? "Yes" : "No") << "\n";
+    }
+
+    csv.close();
+    cout << "Generated: rotating_calipers_benchmark.csv\n";
+    return 0;
+}
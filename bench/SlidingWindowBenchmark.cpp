@@ -0,0 +1,87 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <algorithm>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "DynamicHull/SlidingWindowHull/SlidingWindowHull.h"
+#include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "PointGenerationStrategy/RandomPointStrategy/RandomPointStrategy.h"
+
+using namespace std;
+using namespace std::chrono;
+
+template<typename T>
+bool sameVertexes(const Poligon<T>& a, const Poligon<T>& b) {
+    if (a.numVertexes() != b.numVertexes()) return false;
+    for (size_t i = 0; i < a.numVertexes(); ++i) {
+        if (!(a[i] == b[i])) return false;
+    }
+    return true;
+}
+
+int main() {
+    using T = double;
+    
+    vector<size_t> window_sizes = {100, 1000, 10000, 100000};
+    size_t ticks = 20000;
+    
+    RandomPointGenerator<T> randomGen;
+    DivideAndConquerAlgorithm<T> divideConquer;
+    
+    ofstream csv("sliding_window_benchmark.csv");
+    csv << "Window_Points,Ticks,Window_Tick_us,Recompute_Ticks,Recompute_Tick_us,Speedup,Results_Match\n";
+    
+    cout << "=== SLIDING WINDOW HULL vs DIVIDE & CONQUER RECOMPUTATION ===\n";
+    
+    for (size_t windowSize : window_sizes) {
+        // Fill the window first so every measured tick pushes one point and expires one
+        vector<Point<T>> stream = randomGen.generate(windowSize + ticks);
+        
+        SlidingWindowHull<T> window(windowSize);
+        for (size_t i = 0; i < windowSize; ++i) {
+            window.push(stream[i]);
+        }
+        
+        auto start = high_resolution_clock::now();
+        for (size_t i = windowSize; i < windowSize + ticks; ++i) {
+            window.push(stream[i]);
+            window.hull();
+        }
+        auto end = high_resolution_clock::now();
+        double windowUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / ticks;
+        
+        // Recomputing the whole window every tick; capped so the largest windows finish
+        size_t recomputeTicks = max<size_t>(10, min<size_t>(ticks, 10000000 / windowSize));
+        deque<Point<T>> recent(stream.begin(), stream.begin() + windowSize);
+        Poligon<T> recomputed(vector<Point<T>>{});
+        start = high_resolution_clock::now();
+        for (size_t i = windowSize; i < windowSize + recomputeTicks; ++i) {
+            recent.pop_front();
+            recent.push_back(stream[i]);
+            recomputed = divideConquer.apply(vector<Point<T>>(recent.begin(), recent.end()));
+        }
+        end = high_resolution_clock::now();
+        double recomputeUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / recomputeTicks;
+        double speedup = (windowUs > 0) ? recomputeUs / windowUs : 0.0;
+        
+        // Both sides agree on the final window contents
+        vector<Point<T>> last(stream.end() - windowSize, stream.end());
+        bool resultsMatch = sameVertexes(window.hull(), divideConquer.apply(last));
+        
+        csv << windowSize << "," << ticks << "," << fixed << setprecision(3)
+            << windowUs << "," << recomputeTicks << "," << recomputeUs << ","
+            << speedup << "," << (resultsMatch ? "Yes" : "No") << "\n";
+        
+        cout << "  window of " << windowSize << " points: " << fixed << setprecision(3) << windowUs
+             << "us/tick, D&C recompute " << recomputeUs << "us/tick, speedup " << speedup
+             << "x, Match: " << (resultsMatch ? "Yes" : "No") << "\n";
+    }
+    
+    csv.close();
+    cout << "Generated: sliding_window_benchmark.csv\n";
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "BatchConvexHull.h"
+#include "ConvexHullStrategy/MonotoneChain/MonotoneChain.h"
+#include <algorithm>
+
+template<typename T>
+BatchConvexHull<T>::BatchConvexHull(size_t numThreads, size_t grainSize)
+    : grainSize(std::max<size_t>(grainSize, 1)),
+      pool(std::make_unique<WorkStealingPool>(numThreads)) {}
+
+template<typename T>
+void BatchConvexHull<T>::apply(const std::vector<Point<T>>& points, const std::vector<size_t>& offsets,
+                               std::vector<Point<T>>& hulls, std::vector<size_t>& hullOffsets) {
+    size_t numClouds = offsets.empty() ? 0 : offsets.size() - 1;
+    hullOffsets.assign(numClouds + 1, 0);
+
+    // A hull never outgrows its cloud, so hull i is first staged as indices into cloud i at
+    // offsets[i] and the clouds can be solved in any order without coordinating output positions
+    std::vector<uint32_t> staged(points.size());
+    std::vector<size_t> hullSizes(numClouds);
+
+    pool->parallelFor(0, numClouds, grainSize, [&](size_t chunkBegin, size_t chunkEnd) {
+        Scratch scratch;
+        for (size_t c = chunkBegin; c < chunkEnd; c++) {
+            size_t begin = offsets[c];
+            size_t end = offsets[c + 1];
+
+            size_t size = end - begin;
+            if (size < 3) {
+                for (size_t k = 0; k < size; k++) {
+                    staged[begin + k] = static_cast<uint32_t>(k);
+                }
+            } else {
+                size = hull(points, begin, end, scratch);
+                for (size_t k = 0; k < size; k++) {
+                    staged[begin + k] = scratch.sites[scratch.chain[k]].index;
+                }
+            }
+            hullSizes[c] = size;
+        }
+    });
+
+    size_t total = 0;
+    for (size_t c = 0; c < numClouds; c++) {
+        hullOffsets[c] = total;
+        total += hullSizes[c];
+    }
+    hullOffsets[numClouds] = total;
+
+    hulls.clear();
+    hulls.reserve(total);
+    for (size_t c = 0; c < numClouds; c++) {
+        for (size_t k = 0; k < hullSizes[c]; k++) {
+            hulls.push_back(points[offsets[c] + staged[offsets[c] + k]]);
+        }
+    }
+}
+
+// Coordinates are read once into flat sites and the sort and the shared monotone chain work on
+// those, so the inner loops touch no Point
+template<typename T>
+size_t BatchConvexHull<T>::hull(const std::vector<Point<T>>& points, size_t begin, size_t end, Scratch& scratch) {
+    size_t n = end - begin;
+    std::vector<Site>& sites = scratch.sites;
+    std::vector<uint32_t>& chain = scratch.chain;
+    sites.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        sites[i] = {points[begin + i].getX(), points[begin + i].getY(), static_cast<uint32_t>(i)};
+    }
+    std::sort(sites.begin(), sites.end(), [](const Site& a, const Site& b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+
+    MonotoneChain::build(n,
+        [&sites](uint32_t a, uint32_t b, uint32_t c) {
+            return OrientationPredicate<T>::sign(sites[a].x, sites[a].y, sites[b].x, sites[b].y,
+                                                 sites[c].x, sites[c].y) > 0;
+        },
+        [&sites](uint32_t a, uint32_t b) { return sites[a].x == sites[b].x && sites[a].y == sites[b].y; },
+        chain);
+
+    return chain.size();
+}
+
+// Explicit template instantiations
+template class BatchConvexHull<int>;
+template class BatchConvexHull<float>;
+template class BatchConvexHull<double>;
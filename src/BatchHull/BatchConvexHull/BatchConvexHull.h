@@ -0,0 +1,49 @@
+#ifndef BATCHCONVEXHULL_H
+#define BATCHCONVEXHULL_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ThreadPool/WorkStealingPool.h"
+
+// Hulls of many small clouds in one call. The clouds share one flat point buffer delimited by
+// an offsets array, and the hulls come back the same way, so there is no per-cloud vector,
+// Poligon or virtual call. Clouds are split across the pool in chunks of grainSize, and every
+// chunk reuses one site buffer and one chain buffer for all of its clouds
+template<typename T>
+class BatchConvexHull {
+public:
+    explicit BatchConvexHull(size_t numThreads = 1, size_t grainSize = 1024);
+
+    // Cloud i is points[offsets[i], offsets[i + 1]), so offsets holds one entry more than there
+    // are clouds. Hull i is written to hulls[hullOffsets[i], hullOffsets[i + 1]) with the same
+    // vertices MonotoneChainAlgorithm returns: CCW from the lexicographic minimum without
+    // collinear vertices, and clouds of fewer than 3 points unchanged
+    void apply(const std::vector<Point<T>>& points, const std::vector<size_t>& offsets,
+               std::vector<Point<T>>& hulls, std::vector<size_t>& hullOffsets);
+
+private:
+    size_t grainSize;
+    std::unique_ptr<WorkStealingPool> pool;
+
+    // A point of the cloud being solved, by its position in the cloud
+    struct Site {
+        T x;
+        T y;
+        uint32_t index;
+    };
+
+    // Buffers reused by every cloud of a chunk
+    struct Scratch {
+        std::vector<Site> sites;
+        // Hull vertices as positions in the sorted sites
+        std::vector<uint32_t> chain;
+    };
+
+    // Leaves the hull of points[begin, end) in scratch.chain and returns its size
+    static size_t hull(const std::vector<Point<T>>& points, size_t begin, size_t end, Scratch& scratch);
+};
+
+#endif
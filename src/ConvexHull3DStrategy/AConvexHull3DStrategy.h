@@ -0,0 +1,15 @@
+#ifndef ACONVEXHULL3DSTRATEGY_H
+#define ACONVEXHULL3DSTRATEGY_H
+#include <vector>
+#include "Polyhedron/Polyhedron.h"
+#include "Point/Point.h"
+
+template<typename T>
+class AConvexHull3DStrategy {
+public:
+    virtual ~AConvexHull3DStrategy() = default;
+
+    virtual Polyhedron<T> apply(const std::vector<Point3<T>>& cloud) = 0;
+};
+
+#endif // ACONVEXHULL3DSTRATEGY_H
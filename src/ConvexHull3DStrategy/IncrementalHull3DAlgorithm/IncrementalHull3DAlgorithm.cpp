@@ -0,0 +1,368 @@
+#include "IncrementalHull3DAlgorithm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include "Vector/Vector.h"
+
+template<typename T>
+IncrementalHull3DAlgorithm<T>::IncrementalHull3DAlgorithm(unsigned int seed) : seed(seed) {}
+
+template<typename T>
+Polyhedron<T> IncrementalHull3DAlgorithm<T>::apply(const std::vector<Point3<T>>& cloud) {
+    Workspace ws{{}, {}, {}, {}, {}, {}, {}, {}, Wide(0), 0, 0};
+    if (cloud.empty()) {
+        return Polyhedron<T>({}, {});
+    }
+
+    // Widened before the sign is dropped, since the integer minimum has no positive int
+    auto magnitude = [](T coordinate) {
+        Wide value = Wide(coordinate);
+        return value < 0 ? -value : value;
+    };
+    ws.sites.reserve(cloud.size());
+    for (const Point3<T>& p : cloud) {
+        ws.sites.push_back(Site{{p.getX(), p.getY(), p.getZ()}, NONE, NONE});
+        ws.scale = std::max({ws.scale, magnitude(p.getX()), magnitude(p.getY()), magnitude(p.getZ())});
+    }
+
+    Index base[4];
+    size_t found = initialTetrahedron(ws, base);
+    if (found < 4) {
+        std::vector<Point3<T>> extremes;
+        for (size_t i = 0; i < found; ++i) {
+            extremes.push_back(cloud[base[i]]);
+        }
+        return Polyhedron<T>(extremes, {});
+    }
+
+    // base[3] lies below (base[0], base[1], base[2]), so these four faces point outwards
+    Index a = base[0], b = base[1], c = base[2], d = base[3];
+    newFace(ws, a, b, c);
+    newFace(ws, b, a, d);
+    newFace(ws, c, b, d);
+    newFace(ws, a, c, d);
+    for (Index f = 0; f < 4; ++f) {
+        for (Index k = 0; k < 3; ++k) {
+            for (Index g = 0; g < 4; ++g) {
+                for (Index m = 0; m < 3; ++m) {
+                    if (ws.faces[f].vertex[k] == ws.faces[g].vertex[(m + 1) % 3] &&
+                        ws.faces[f].vertex[(k + 1) % 3] == ws.faces[g].vertex[m]) {
+                        ws.faces[f].twin[k] = 3 * g + m;
+                    }
+                }
+            }
+        }
+    }
+
+    Index n = static_cast<Index>(cloud.size());
+    ws.mark.assign(n, 0);
+    ws.horizonNext.assign(n, 0);
+
+    std::vector<Index> order;
+    order.reserve(n);
+    for (Index q = 0; q < n; ++q) {
+        if (q == a || q == b || q == c || q == d) continue;
+        order.push_back(q);
+        for (Index f = 0; f < 4; ++f) {
+            if (sees(ws, ws.faces[f], q)) {
+                ws.faces[f].conflicts.push_back(q);
+                if (ws.sites[q].conflict == NONE) {
+                    ws.sites[q].conflict = f;
+                }
+            }
+        }
+    }
+
+    std::mt19937 random(seed);
+    std::shuffle(order.begin(), order.end(), random);
+    for (Index q : order) {
+        // Points whose last conflict died unreplaced are inside; a recycled face id left
+        // behind in conflict is rejected by sees
+        Index f = ws.sites[q].conflict;
+        if (f == NONE || !ws.faces[f].alive || !sees(ws, ws.faces[f], q)) continue;
+        insert(ws, q);
+    }
+
+    // Compact the used points into the vertex list
+    std::vector<Point3<T>> vertexes;
+    std::vector<std::array<size_t, 3>> faces;
+    for (Site& site : ws.sites) {
+        site.stamp = NONE;
+    }
+    for (const Face& face : ws.faces) {
+        if (!face.alive) continue;
+        std::array<size_t, 3> triangle;
+        for (size_t k = 0; k < 3; ++k) {
+            Index v = face.vertex[k];
+            if (ws.sites[v].stamp == NONE) {
+                ws.sites[v].stamp = static_cast<Index>(vertexes.size());
+                vertexes.push_back(cloud[v]);
+            }
+            triangle[k] = ws.sites[v].stamp;
+        }
+        faces.push_back(triangle);
+    }
+
+    return Polyhedron<T>(vertexes, faces);
+}
+
+template<typename T>
+size_t IncrementalHull3DAlgorithm<T>::initialTetrahedron(Workspace& ws, Index (&base)[4]) const {
+    const std::vector<Site>& sites = ws.sites;
+    auto diff = [&](Index from, Index to, Wide (&out)[3]) {
+        for (size_t i = 0; i < 3; ++i) {
+            out[i] = Wide(sites[to].coordinate[i]) - Wide(sites[from].coordinate[i]);
+        }
+    };
+    auto norm1 = [](const Wide (&v)[3]) {
+        return (v[0] < 0 ? -v[0] : v[0]) + (v[1] < 0 ? -v[1] : v[1]) + (v[2] < 0 ? -v[2] : v[2]);
+    };
+    Index n = static_cast<Index>(sites.size());
+
+    base[0] = 0;
+    for (Index q = 1; q < n; ++q) {
+        if (sites[q].coordinate[0] < sites[base[0]].coordinate[0]) {
+            base[0] = q;
+        }
+    }
+
+    // Farthest point from the first extreme
+    Wide best = 0;
+    base[1] = base[0];
+    for (Index q = 0; q < n; ++q) {
+        Wide u[3];
+        diff(base[0], q, u);
+        Wide size = norm1(u);
+        if (size > best) {
+            best = size;
+            base[1] = q;
+        }
+    }
+    if (best <= 0) return 1;
+
+    // Farthest point from the line through both
+    Wide u[3];
+    diff(base[0], base[1], u);
+    best = 0;
+    Wide bestBound = 0;
+    base[2] = base[0];
+    for (Index q = 0; q < n; ++q) {
+        Wide v[3];
+        diff(base[0], q, v);
+        Wide w[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+        Wide size = norm1(w);
+        if (size > best) {
+            best = size;
+            bestBound = tolerance() * norm1(u) * norm1(v);
+            base[2] = q;
+        }
+    }
+    if (best <= bestBound) return 2;
+
+    // Farthest point from the plane through the three
+    Index f = newFace(ws, base[0], base[1], base[2]);
+    best = 0;
+    Wide bestSide = 0;
+    base[3] = base[0];
+    for (Index q = 0; q < n; ++q) {
+        const Face& face = ws.faces[f];
+        const T* point = sites[q].coordinate;
+        Wide side = face.normal[0] * Wide(point[0]) + face.normal[1] * Wide(point[1]) +
+                    face.normal[2] * Wide(point[2]) - face.offset;
+        Wide size = side < 0 ? -side : side;
+        if (size > best) {
+            best = size;
+            bestSide = side;
+            base[3] = q;
+        }
+    }
+    bool flat = best <= ws.faces[f].tolerance;
+    ws.faces.clear();
+    if (flat) return 3;
+
+    if (bestSide > 0) {
+        std::swap(base[1], base[2]);
+    }
+    return 4;
+}
+
+template<typename T>
+void IncrementalHull3DAlgorithm<T>::insert(Workspace& ws, Index p) const {
+    Index round = ++ws.round;
+    std::vector<Face>& faces = ws.faces;
+
+    // The faces p sees form a connected region around its conflict face
+    ws.visible.clear();
+    Index start = ws.sites[p].conflict;
+    ws.sites[p].conflict = NONE;
+    faces[start].visited = round;
+    faces[start].visible = true;
+    ws.visible.push_back(start);
+    for (size_t i = 0; i < ws.visible.size(); ++i) {
+        const Face& face = faces[ws.visible[i]];
+        for (size_t k = 0; k < 3; ++k) {
+            Face& neighbour = faces[face.twin[k] / 3];
+            if (neighbour.visited == round) continue;
+            neighbour.visited = round;
+            neighbour.visible = sees(ws, neighbour, p);
+            if (neighbour.visible) {
+                ws.visible.push_back(face.twin[k] / 3);
+            }
+        }
+    }
+
+    // Its boundary must be a single simple cycle; rounding in a nearly flat region can break
+    // that, and such a point is left out as lying on the hull within tolerance
+    size_t horizonSize = 0;
+    Index first = NONE;
+    for (Index f : ws.visible) {
+        for (Index k = 0; k < 3; ++k) {
+            if (faces[faces[f].twin[k] / 3].visible) continue;
+            Index from = faces[f].vertex[k];
+            if (ws.mark[from] == round) return;
+            ws.mark[from] = round;
+            ws.horizonNext[from] = 3 * f + k;
+            first = 3 * f + k;
+            ++horizonSize;
+        }
+    }
+    ws.horizon.clear();
+    for (Index edge = first;;) {
+        ws.horizon.push_back(edge);
+        Index to = faces[edge / 3].vertex[(edge % 3 + 1) % 3];
+        if (ws.mark[to] != round) return;
+        edge = ws.horizonNext[to];
+        if (edge == first) break;
+        if (ws.horizon.size() == horizonSize) return;
+    }
+    if (ws.horizon.size() != horizonSize) return;
+
+    for (Index f : ws.visible) {
+        faces[f].alive = false;
+    }
+
+    // A cone of new faces from p to the horizon, linked to each other around p and to the
+    // surviving faces across the horizon
+    size_t count = ws.horizon.size();
+    ws.created.clear();
+    for (Index edge : ws.horizon) {
+        const Face& old = faces[edge / 3];
+        Index a = old.vertex[edge % 3];
+        Index b = old.vertex[(edge % 3 + 1) % 3];
+        ws.created.push_back(newFace(ws, a, b, p));
+    }
+    for (size_t i = 0; i < count; ++i) {
+        Index edge = ws.horizon[i];
+        Index id = ws.created[i];
+        Index outside = faces[edge / 3].twin[edge % 3];
+        faces[id].twin[0] = outside;
+        faces[id].twin[1] = 3 * ws.created[(i + 1) % count] + 2;
+        faces[id].twin[2] = 3 * ws.created[(i + count - 1) % count] + 1;
+        faces[outside / 3].twin[outside % 3] = 3 * id;
+    }
+
+    // A pending point sees a new face only if it saw one of the two faces that met at its
+    // horizon edge
+    for (size_t i = 0; i < count; ++i) {
+        Index id = ws.created[i];
+        ++ws.stampCounter;
+        gather(ws, ws.horizon[i] / 3, id, false);
+        gather(ws, faces[id].twin[0] / 3, id, true);
+    }
+
+    for (Index f : ws.visible) {
+        std::vector<Index>().swap(faces[f].conflicts);
+        ws.freeFaces.push_back(f);
+    }
+}
+
+template<typename T>
+void IncrementalHull3DAlgorithm<T>::gather(Workspace& ws, Index source, Index target, bool survivor) const {
+    std::vector<Face>& faces = ws.faces;
+    for (Index q : faces[source].conflicts) {
+        if (ws.sites[q].conflict == NONE || ws.sites[q].stamp == ws.stampCounter) continue;
+        ws.sites[q].stamp = ws.stampCounter;
+
+        // A surviving face q sees is a valid conflict even when no new face is
+        if (survivor && !faces[ws.sites[q].conflict].alive) {
+            ws.sites[q].conflict = source;
+        }
+        if (sees(ws, faces[target], q)) {
+            faces[target].conflicts.push_back(q);
+            if (!faces[ws.sites[q].conflict].alive) {
+                ws.sites[q].conflict = target;
+            }
+        }
+    }
+}
+
+template<typename T>
+typename IncrementalHull3DAlgorithm<T>::Index IncrementalHull3DAlgorithm<T>::newFace(Workspace& ws, Index a, Index b, Index c) const {
+    Index id;
+    if (ws.freeFaces.empty()) {
+        id = static_cast<Index>(ws.faces.size());
+        ws.faces.emplace_back();
+    } else {
+        id = ws.freeFaces.back();
+        ws.freeFaces.pop_back();
+    }
+
+    Face& face = ws.faces[id];
+    face.vertex[0] = a;
+    face.vertex[1] = b;
+    face.vertex[2] = c;
+    face.visited = 0;
+    face.visible = false;
+    face.alive = true;
+    face.conflicts.clear();
+
+    const T* A = ws.sites[a].coordinate;
+    const T* B = ws.sites[b].coordinate;
+    const T* C = ws.sites[c].coordinate;
+    if constexpr (std::is_integral_v<T>) {
+        Wide u[3] = {Wide(B[0]) - A[0], Wide(B[1]) - A[1], Wide(B[2]) - A[2]};
+        Wide v[3] = {Wide(C[0]) - A[0], Wide(C[1]) - A[1], Wide(C[2]) - A[2]};
+        face.normal[0] = u[1] * v[2] - u[2] * v[1];
+        face.normal[1] = u[2] * v[0] - u[0] * v[2];
+        face.normal[2] = u[0] * v[1] - u[1] * v[0];
+        face.offset = face.normal[0] * A[0] + face.normal[1] * A[1] + face.normal[2] * A[2];
+        face.tolerance = 0;
+    } else {
+        Vector<T> u(B[0] - A[0], B[1] - A[1], B[2] - A[2]);
+        Vector<T> v(C[0] - A[0], C[1] - A[1], C[2] - A[2]);
+        Vector<T> normal = u.cross(v);
+        face.normal[0] = normal.getX();
+        face.normal[1] = normal.getY();
+        face.normal[2] = normal.getZ();
+        face.offset = normal.dot(Vector<T>(A[0], A[1], A[2]));
+        // Bounds the rounding of both the normal and the side test for any point of the cloud
+        T spanU = std::abs(u.getX()) + std::abs(u.getY()) + std::abs(u.getZ());
+        T spanV = std::abs(v.getX()) + std::abs(v.getY()) + std::abs(v.getZ());
+        face.tolerance = tolerance() * spanU * spanV * ws.scale;
+    }
+    return id;
+}
+
+template<typename T>
+bool IncrementalHull3DAlgorithm<T>::sees(const Workspace& ws, const Face& face, Index q) const {
+    const T* point = ws.sites[q].coordinate;
+    Wide side = face.normal[0] * Wide(point[0]) + face.normal[1] * Wide(point[1]) +
+                face.normal[2] * Wide(point[2]) - face.offset;
+    return side > face.tolerance;
+}
+
+template<typename T>
+typename IncrementalHull3DAlgorithm<T>::Wide IncrementalHull3DAlgorithm<T>::tolerance() const {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::numeric_limits<T>::epsilon() * 32;
+    } else {
+        return 0;
+    }
+}
+
+// Explicit template instantiations
+template class IncrementalHull3DAlgorithm<int>;
+template class IncrementalHull3DAlgorithm<float>;
+template class IncrementalHull3DAlgorithm<double>;
@@ -0,0 +1,79 @@
+#ifndef INCREMENTALHULL3DALGORITHM_H
+#define INCREMENTALHULL3DALGORITHM_H
+
+#include "ConvexHull3DStrategy/AConvexHull3DStrategy.h"
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "Polyhedron/Polyhedron.h"
+#include "Point/Point.h"
+
+// Randomized incremental 3D hull (Clarkson-Shor): points are inserted in random order and a
+// conflict graph tracks which faces every pending point sees, for O(n log n) expected time.
+// The result is a closed triangle mesh with outward faces. Clouds with no four non-coplanar
+// points give a mesh without faces that holds only the extremes found (at most three).
+// Up to 2^32 - 2 points are supported
+template<typename T>
+class IncrementalHull3DAlgorithm : public AConvexHull3DStrategy<T> {
+public:
+    explicit IncrementalHull3DAlgorithm(unsigned int seed = 5489u);
+
+    Polyhedron<T> apply(const std::vector<Point3<T>>& cloud) override;
+
+private:
+    using Index = uint32_t;
+    // Integer planes are evaluated exactly; floating planes get a rounding tolerance
+    using Wide = std::conditional_t<std::is_integral_v<T>, __int128, T>;
+    static constexpr Index NONE = UINT32_MAX;
+
+    // Half-edge 3 * f + k runs from vertex[k] to vertex[(k + 1) % 3] of face f, so next and
+    // face are implicit and only the twin is stored
+    struct Face {
+        Index vertex[3];
+        Index twin[3];
+        Wide normal[3];
+        Wide offset;
+        Wide tolerance;
+        Index visited;
+        bool visible;
+        bool alive;
+        // Pending points that see this face
+        std::vector<Index> conflicts;
+    };
+
+    // Everything the conflict updates touch for one point, packed into a single record
+    struct Site {
+        T coordinate[3];
+        // One alive face the point sees, NONE once inserted or found inside
+        Index conflict;
+        // Last new face the point was tested against
+        Index stamp;
+    };
+
+    struct Workspace {
+        std::vector<Site> sites;
+        std::vector<Face> faces;
+        std::vector<Index> freeFaces;
+        // Per hull vertex: round of the last horizon visit and the horizon edge leaving it
+        std::vector<Index> mark;
+        std::vector<Index> horizonNext;
+        std::vector<Index> visible;
+        std::vector<Index> horizon;
+        std::vector<Index> created;
+        Wide scale;
+        Index round;
+        Index stampCounter;
+    };
+
+    unsigned int seed;
+
+    // Returns how many affinely independent extremes were found; four give the starting tetrahedron
+    size_t initialTetrahedron(Workspace& ws, Index (&base)[4]) const;
+    void insert(Workspace& ws, Index p) const;
+    void gather(Workspace& ws, Index source, Index target, bool survivor) const;
+    Index newFace(Workspace& ws, Index a, Index b, Index c) const;
+    bool sees(const Workspace& ws, const Face& face, Index q) const;
+    Wide tolerance() const;
+};
+
+#endif
@@ -3,11 +3,30 @@
 #include <vector>
 #include "Poligon/Poligon.h"
 #include "Point/Point.h"
+#include "PointCloud/PointCloud.h"
 
 template<typename T>
 class AConvexHullStrategy {
 public:
+    virtual ~AConvexHullStrategy() = default;
+
     virtual Poligon<T> apply(const std::vector<Point<T>>& cloud) = 0;
+
+    // Same vertices as apply(), written into hull so its capacity is reused. Strategies that
+    // keep a HullWorkspace override it to run without allocating
+    virtual void applyInto(const std::vector<Point<T>>& cloud, std::vector<Point<T>>& hull) {
+        Poligon<T> result = apply(cloud);
+        hull.clear();
+        for (size_t i = 0; i < result.numVertexes(); ++i) {
+            hull.push_back(result[i]);
+        }
+    }
+
+    // Hull of a column-stored cloud. The default goes through a vector of points; strategies
+    // that can read the columns in place override it
+    virtual Poligon<T> applyCloud(const PointCloud<T>& cloud) {
+        return apply(cloud.toPoints());
+    }
 };
 
 #endif // ACONVEXHULLSTRATEGY_H
@@ -0,0 +1,122 @@
+#include "AklToussaintFilter.h"
+#include <cmath>
+#include <type_traits>
+
+template<typename T>
+AklToussaintFilter<T>::AklToussaintFilter(AConvexHullStrategy<T>& inner) : inner(inner) {}
+
+template<typename T>
+Poligon<T> AklToussaintFilter<T>::apply(const std::vector<Point<T>>& cloud) {
+    droppedCount = 0;
+
+    std::vector<Point<T>> corners = octagon(cloud);
+    if (corners.size() < 3) {
+        return inner.apply(cloud);
+    }
+
+    // Fixed 8-edge layout so the per-point test is a branch-free unrolled loop;
+    // missing edges repeat the first one, which does not change the region
+    // Integer edges and turns are widened so coordinates of any magnitude stay exact
+    using Diff = typename OrientationPredicate<T>::Diff;
+    using Wide = typename OrientationPredicate<T>::Wide;
+    constexpr size_t numEdges = 8;
+    T ax[numEdges], ay[numEdges];
+    Diff ex[numEdges], ey[numEdges];
+    for (size_t e = 0; e < numEdges; ++e) {
+        size_t i = (e < corners.size()) ? e : 0;
+        const Point<T>& a = corners[i];
+        const Point<T>& b = corners[(i + 1) % corners.size()];
+        ax[e] = a.getX();
+        ay[e] = a.getY();
+        ex[e] = Diff(b.getX()) - a.getX();
+        ey[e] = Diff(b.getY()) - a.getY();
+    }
+
+    std::vector<Point<T>> survivors;
+    survivors.reserve(cloud.size());
+    for (const auto& point : cloud) {
+        T px = point.getX();
+        T py = point.getY();
+
+        // A point is dropped only when it is certainly inside: floating-point turns must clear
+        // the rounding bound, so doubtful points stay and the inner strategy decides exactly
+        bool inside = true;
+        for (size_t e = 0; e < numEdges; ++e) {
+            Wide left = Wide(ex[e]) * (Diff(py) - ay[e]);
+            Wide right = Wide(ey[e]) * (Diff(px) - ax[e]);
+            if constexpr (std::is_floating_point_v<T>) {
+                inside &= (left - right) > OrientationPredicate<T>::ERROR_BOUND * (std::abs(left) + std::abs(right));
+            } else {
+                inside &= left > right;
+            }
+        }
+
+        if (!inside) {
+            survivors.push_back(point);
+        }
+    }
+
+    droppedCount = cloud.size() - survivors.size();
+    return inner.apply(survivors);
+}
+
+template<typename T>
+size_t AklToussaintFilter<T>::lastDroppedCount() const {
+    return droppedCount;
+}
+
+// Extreme points in CCW direction order: min y, max x-y, max x, max x+y,
+// max y, min x-y, min x, min x+y; repeated corners are collapsed
+template<typename T>
+std::vector<Point<T>> AklToussaintFilter<T>::octagon(const std::vector<Point<T>>& cloud) const {
+    std::vector<Point<T>> corners;
+    if (cloud.empty()) {
+        return corners;
+    }
+
+    // Sums and differences of int coordinates need 64 bits
+    using Diff = typename OrientationPredicate<T>::Diff;
+    size_t extreme[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    Diff value[8];
+    auto keys = [](const Point<T>& p, Diff* k) {
+        Diff x = p.getX();
+        Diff y = p.getY();
+        k[0] = -y;
+        k[1] = x - y;
+        k[2] = x;
+        k[3] = x + y;
+        k[4] = y;
+        k[5] = y - x;
+        k[6] = -x;
+        k[7] = -x - y;
+    };
+    keys(cloud[0], value);
+
+    Diff candidate[8];
+    for (size_t i = 1; i < cloud.size(); ++i) {
+        keys(cloud[i], candidate);
+        for (size_t d = 0; d < 8; ++d) {
+            if (candidate[d] > value[d]) {
+                value[d] = candidate[d];
+                extreme[d] = i;
+            }
+        }
+    }
+
+    for (size_t d = 0; d < 8; ++d) {
+        const Point<T>& corner = cloud[extreme[d]];
+        if (corners.empty() || !(corners.back() == corner)) {
+            corners.push_back(corner);
+        }
+    }
+    while (corners.size() > 1 && corners.back() == corners.front()) {
+        corners.pop_back();
+    }
+
+    return corners;
+}
+
+// Explicit template instantiations
+template class AklToussaintFilter<int>;
+template class AklToussaintFilter<float>;
+template class AklToussaintFilter<double>;
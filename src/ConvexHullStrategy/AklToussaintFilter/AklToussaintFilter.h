@@ -0,0 +1,29 @@
+#ifndef AKLTOUSSAINTFILTER_H
+#define AKLTOUSSAINTFILTER_H
+
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+// Decorator that discards every point strictly inside the octagon spanned by the
+// extremes in x, y, x+y and x-y before delegating to the wrapped strategy
+template<typename T>
+class AklToussaintFilter : public AConvexHullStrategy<T> {
+public:
+    explicit AklToussaintFilter(AConvexHullStrategy<T>& inner);
+
+    Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+
+    // Points removed by the filter during the last apply()
+    size_t lastDroppedCount() const;
+
+private:
+    AConvexHullStrategy<T>& inner;
+    size_t droppedCount = 0;
+
+    std::vector<Point<T>> octagon(const std::vector<Point<T>>& cloud) const;
+};
+
+#endif
@@ -0,0 +1,190 @@
+#include "ApproximateHullAlgorithm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+template<typename T>
+ApproximateHullAlgorithm<T>::ApproximateHullAlgorithm(double epsilon, size_t vertexBudget)
+    : epsilon(epsilon), vertexBudget(vertexBudget) {}
+
+template<typename T>
+Poligon<T> ApproximateHullAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    error = 0.0;
+    stripCount = 0;
+    if (cloud.size() < 3) {
+        return exactChain.apply(cloud);
+    }
+
+    // Leftmost and rightmost points, keeping the lowest and highest of each tie
+    size_t minLow = 0, minHigh = 0, maxLow = 0, maxHigh = 0;
+    for (size_t i = 1; i < cloud.size(); ++i) {
+        T x = cloud[i].getX();
+        T y = cloud[i].getY();
+        if (x < cloud[minLow].getX()) {
+            minLow = minHigh = i;
+        } else if (x == cloud[minLow].getX()) {
+            if (y < cloud[minLow].getY()) minLow = i;
+            if (y > cloud[minHigh].getY()) minHigh = i;
+        }
+        if (x > cloud[maxLow].getX()) {
+            maxLow = maxHigh = i;
+        } else if (x == cloud[maxLow].getX()) {
+            if (y < cloud[maxLow].getY()) maxLow = i;
+            if (y > cloud[maxHigh].getY()) maxHigh = i;
+        }
+    }
+
+    double xmin = static_cast<double>(cloud[minLow].getX());
+    double width = static_cast<double>(cloud[maxLow].getX()) - xmin;
+    size_t k = numStrips(width);
+    if (k > cloud.size() || 2 * k + 4 >= cloud.size()) {
+        return exactChain.apply(cloud);
+    }
+    stripCount = k;
+
+    constexpr size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> low(k, NONE);
+    std::vector<size_t> high(k, NONE);
+    double scale = (width > 0) ? static_cast<double>(k) / width : 0.0;
+    for (size_t i = 0; i < cloud.size(); ++i) {
+        size_t strip = std::min(k - 1, static_cast<size_t>((static_cast<double>(cloud[i].getX()) - xmin) * scale));
+        T y = cloud[i].getY();
+        if (low[strip] == NONE || y < cloud[low[strip]].getY()) low[strip] = i;
+        if (high[strip] == NONE || y > cloud[high[strip]].getY()) high[strip] = i;
+    }
+
+    // Strips are ordered by x, so sorting each strip's few candidates sorts them all
+    auto lexicographic = [&](size_t a, size_t b) {
+        return cloud[a].getX() < cloud[b].getX() ||
+               (cloud[a].getX() == cloud[b].getX() && cloud[a].getY() < cloud[b].getY());
+    };
+    std::vector<Point<T>> candidates;
+    candidates.reserve(2 * k + 4);
+    for (size_t strip = 0; strip < k; ++strip) {
+        size_t bucket[6];
+        size_t size = 0;
+        if (low[strip] != NONE) {
+            bucket[size++] = low[strip];
+            bucket[size++] = high[strip];
+        }
+        if (strip == 0) {
+            bucket[size++] = minLow;
+            bucket[size++] = minHigh;
+        }
+        if (strip == k - 1) {
+            bucket[size++] = maxLow;
+            bucket[size++] = maxHigh;
+        }
+        std::sort(bucket, bucket + size, lexicographic);
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0 && cloud[bucket[i]] == cloud[bucket[i - 1]]) continue;
+            candidates.push_back(cloud[bucket[i]]);
+        }
+    }
+
+    Poligon<T> hull = sortedChain.apply(candidates);
+    error = measureError(cloud, hull);
+    return hull;
+}
+
+template<typename T>
+double ApproximateHullAlgorithm<T>::lastError() const {
+    return error;
+}
+
+template<typename T>
+size_t ApproximateHullAlgorithm<T>::lastStripCount() const {
+    return stripCount;
+}
+
+// Returns more strips than points when epsilon asks for more precision than the strips
+// can give, which sends apply() to the exact hull
+template<typename T>
+size_t ApproximateHullAlgorithm<T>::numStrips(double width) const {
+    if (width <= 0) return 1;
+    if (vertexBudget > 0) {
+        return std::max<size_t>(1, (std::max<size_t>(vertexBudget, 6) - 4) / 2);
+    }
+
+    constexpr size_t unbounded = std::numeric_limits<size_t>::max() / 4;
+    if (!(epsilon > 0)) return unbounded;
+    double strips = std::ceil(width / epsilon);
+    if (strips >= static_cast<double>(unbounded)) return unbounded;
+    return std::max<size_t>(1, static_cast<size_t>(strips));
+}
+
+// Points outside the polygon are found by locating them against the lower and upper chains;
+// only those few need the distance to every edge
+template<typename T>
+double ApproximateHullAlgorithm<T>::measureError(const std::vector<Point<T>>& cloud, const Poligon<T>& hull) const {
+    size_t m = hull.numVertexes();
+    std::vector<double> hx(m), hy(m);
+    for (size_t i = 0; i < m; ++i) {
+        hx[i] = static_cast<double>(hull[i].getX());
+        hy[i] = static_cast<double>(hull[i].getY());
+    }
+
+    auto distance = [&](double px, double py, size_t a, size_t b) {
+        double ex = hx[b] - hx[a];
+        double ey = hy[b] - hy[a];
+        double length = ex * ex + ey * ey;
+        double t = (length > 0) ? ((px - hx[a]) * ex + (py - hy[a]) * ey) / length : 0.0;
+        t = std::clamp(t, 0.0, 1.0);
+        return std::hypot(px - (hx[a] + t * ex), py - (hy[a] + t * ey));
+    };
+    auto boundaryDistance = [&](double px, double py) {
+        double best = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < m; ++i) {
+            best = std::min(best, distance(px, py, i, (i + 1) % m));
+        }
+        return best;
+    };
+
+    double worst = 0.0;
+    if (m < 3) {
+        for (const Point<T>& p : cloud) {
+            worst = std::max(worst, boundaryDistance(static_cast<double>(p.getX()), static_cast<double>(p.getY())));
+        }
+        return worst;
+    }
+
+    // The polygon is CCW from its lexicographic minimum: the lower chain runs up to the
+    // lexicographic maximum r and the upper chain comes back from it
+    size_t r = 0;
+    for (size_t i = 1; i < m; ++i) {
+        if (hx[i] > hx[r] || (hx[i] == hx[r] && hy[i] > hy[r])) r = i;
+    }
+    std::vector<size_t> upper;
+    for (size_t i = r; i < m; ++i) upper.push_back(i);
+    upper.push_back(0);
+
+    auto below = [&](double px, double py, size_t a, size_t b) {
+        return (hx[b] - hx[a]) * (py - hy[a]) - (hy[b] - hy[a]) * (px - hx[a]) < 0;
+    };
+
+    for (const Point<T>& p : cloud) {
+        double px = static_cast<double>(p.getX());
+        double py = static_cast<double>(p.getY());
+
+        size_t i = std::lower_bound(hx.begin() + 1, hx.begin() + r + 1, px) - (hx.begin() + 1);
+        i = std::min(i, r - 1);
+        bool outside = below(px, py, i, i + 1);
+
+        if (!outside) {
+            size_t j = std::lower_bound(upper.begin() + 1, upper.end(), px,
+                                        [&](size_t v, double x) { return hx[v] > x; }) - (upper.begin() + 1);
+            j = std::min(j, upper.size() - 2);
+            outside = below(px, py, upper[j], upper[j + 1]);
+        }
+
+        if (outside) {
+            worst = std::max(worst, boundaryDistance(px, py));
+        }
+    }
+    return worst;
+}
+
+// Explicit template instantiations
+template class ApproximateHullAlgorithm<int>;
+template class ApproximateHullAlgorithm<float>;
+template class ApproximateHullAlgorithm<double>;
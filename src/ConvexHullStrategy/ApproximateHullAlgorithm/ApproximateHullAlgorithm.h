@@ -0,0 +1,41 @@
+#ifndef APPROXIMATEHULLALGORITHM_H
+#define APPROXIMATEHULLALGORITHM_H
+
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+// Bentley-Faust-Preparata approximation: the x-range of the cloud is cut into k strips and
+// only the lowest and highest point of each (plus the x-extremes) is hulled, in O(n + k).
+// Every point of the cloud lies within width / k of the result, which has at most 2k + 4
+// vertexes and is always contained in the exact hull.
+template<typename T>
+class ApproximateHullAlgorithm : public AConvexHullStrategy<T> {
+public:
+    // k is the fewest strips that guarantee epsilon; a non-zero vertexBudget caps the output
+    // size instead and takes precedence (budgets below 6 behave as 6). When the strips
+    // would not reduce the cloud the exact hull is returned
+    explicit ApproximateHullAlgorithm(double epsilon, size_t vertexBudget = 0);
+
+    Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+
+    // Largest distance from a point of the last cloud to the returned polygon
+    double lastError() const;
+    // Strips used by the last apply(), 0 when it fell back to the exact hull
+    size_t lastStripCount() const;
+
+private:
+    double epsilon;
+    size_t vertexBudget;
+    double error = 0.0;
+    size_t stripCount = 0;
+    MonotoneChainAlgorithm<T> sortedChain{true};
+    MonotoneChainAlgorithm<T> exactChain;
+
+    size_t numStrips(double width) const;
+    double measureError(const std::vector<Point<T>>& cloud, const Poligon<T>& hull) const;
+};
+
+#endif
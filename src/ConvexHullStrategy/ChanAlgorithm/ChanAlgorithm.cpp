@@ -0,0 +1,173 @@
+#include "ChanAlgorithm.h"
+#include <algorithm>
+#include <utility>
+
+template<typename T>
+Poligon<T> ChanAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    if (cloud.size() < 3) {
+        return Poligon<T>(cloud);
+    }
+
+    std::vector<Point<T>> hull;
+
+    // Guess h with m = 2^(2^t) until a wrap of at most m steps closes the hull
+    for (size_t t = 1; ; ++t) {
+        size_t exponent = size_t(1) << t;
+        size_t groupSize = (exponent >= 63) ? cloud.size()
+                                            : std::min(cloud.size(), size_t(1) << exponent);
+        if (wrap(cloud, groupSize, hull)) {
+            break;
+        }
+    }
+
+    return Poligon<T>(std::move(hull), true);
+}
+
+template<typename T>
+bool ChanAlgorithm<T>::wrap(const std::vector<Point<T>>& cloud, size_t groupSize, std::vector<Point<T>>& hull) {
+    groupHulls.clear();
+    groupOffsets.assign(1, 0);
+
+    std::vector<Point<T>> group;
+    group.reserve(groupSize);
+    for (size_t begin = 0; begin < cloud.size(); begin += groupSize) {
+        size_t end = std::min(cloud.size(), begin + groupSize);
+        group.assign(cloud.begin() + begin, cloud.begin() + end);
+
+        Poligon<T> groupHull = groupStrategy.apply(group);
+        for (size_t i = 0; i < groupHull.numVertexes(); ++i) {
+            groupHulls.push_back(groupHull[i]);
+        }
+        groupOffsets.push_back(groupHulls.size());
+    }
+
+    // The lexicographically smallest point is always a hull vertex
+    size_t start = 0;
+    for (size_t i = 1; i < groupHulls.size(); ++i) {
+        const Point<T>& p = groupHulls[i];
+        const Point<T>& s = groupHulls[start];
+        if (p.getX() < s.getX() || (p.getX() == s.getX() && p.getY() < s.getY())) {
+            start = i;
+        }
+    }
+    size_t startGroup = std::upper_bound(groupOffsets.begin(), groupOffsets.end(), start) - groupOffsets.begin() - 1;
+
+    hull.clear();
+    size_t currentGroup = startGroup;
+    size_t currentId = start;
+    size_t numGroups = groupOffsets.size() - 1;
+
+    for (size_t step = 0; step < groupSize; ++step) {
+        const Point<T>& current = groupHulls[currentId];
+        hull.push_back(current);
+
+        // Within its own group the successor is simply the next hull vertex
+        size_t ownBegin = groupOffsets[currentGroup];
+        size_t ownSize = groupOffsets[currentGroup + 1] - ownBegin;
+        size_t nextId = ownBegin + (currentId - ownBegin + 1) % ownSize;
+        size_t nextGroup = currentGroup;
+
+        for (size_t g = 0; g < numGroups; ++g) {
+            if (g == currentGroup) continue;
+            size_t candidate = tangent(groupOffsets[g], groupOffsets[g + 1], current);
+            if (isBetter(current, groupHulls[candidate], groupHulls[nextId])) {
+                nextId = candidate;
+                nextGroup = g;
+            }
+        }
+
+        if (groupHulls[nextId] == groupHulls[start]) {
+            return true;
+        }
+
+        currentId = nextId;
+        currentGroup = nextGroup;
+    }
+
+    return false;
+}
+
+// Vertex of the CCW group hull [begin, end) that leaves every other vertex to the
+// left of from->vertex. Binary search over the bitonic angle sequence seen from 'from'.
+template<typename T>
+size_t ChanAlgorithm<T>::tangent(size_t begin, size_t end, const Point<T>& from) const {
+    size_t k = end - begin;
+    if (k <= 3) {
+        return linearTangent(begin, end, from);
+    }
+
+    const Point<T>* h = groupHulls.data() + begin;
+    auto visible = [&](size_t i) {
+        return OrientationPredicate<T>::orientation(h[i], h[(i + 1) % k], from) != Orientation::COUNTERCLOCKWISE;
+    };
+
+    size_t lo = 1;
+    size_t hi = k - 1;
+    if (!visible(0)) {
+        if (visible(k - 1)) {
+            lo = hi = 0;
+        } else {
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (!visible(mid) && OrientationPredicate<T>::orientation(from, h[0], h[mid]) == Orientation::CLOCKWISE) {
+                    hi = mid;
+                } else {
+                    lo = mid + 1;
+                }
+            }
+        }
+    } else {
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            Orientation side = OrientationPredicate<T>::orientation(from, h[0], h[mid]);
+            if (!visible(mid) || side == Orientation::COUNTERCLOCKWISE ||
+                    (side == Orientation::COLLINEAR && mid != 1)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+    }
+
+    // Degenerate configurations ('from' duplicated on this hull) fall back to a scan
+    const Point<T>& candidate = h[lo];
+    if (candidate == from ||
+            isBetter(from, h[(lo + k - 1) % k], candidate) ||
+            isBetter(from, h[(lo + 1) % k], candidate)) {
+        return linearTangent(begin, end, from);
+    }
+    return begin + lo;
+}
+
+template<typename T>
+size_t ChanAlgorithm<T>::linearTangent(size_t begin, size_t end, const Point<T>& from) const {
+    size_t best = begin;
+    for (size_t i = begin + 1; i < end; ++i) {
+        if (isBetter(from, groupHulls[i], groupHulls[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// True when challenger leaves incumbent to its left (or is farther along the same ray)
+template<typename T>
+bool ChanAlgorithm<T>::isBetter(const Point<T>& from, const Point<T>& challenger, const Point<T>& incumbent) const {
+    if (challenger == from) return false;
+    if (incumbent == from) return true;
+
+    switch (OrientationPredicate<T>::orientation(from, incumbent, challenger)) {
+        case Orientation::CLOCKWISE:
+            return true;
+        case Orientation::COLLINEAR:
+            return OrientationPredicate<T>::squaredDistance(from, challenger) > OrientationPredicate<T>::squaredDistance(from, incumbent);
+        case Orientation::COUNTERCLOCKWISE:
+            break;
+    }
+    return false;
+}
+
+// Explicit template instantiations
+template class ChanAlgorithm<int>;
+template class ChanAlgorithm<float>;
+template class ChanAlgorithm<double>;
@@ -0,0 +1,29 @@
+#ifndef CHANALGORITHM_H
+#define CHANALGORITHM_H
+
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+template<typename T>
+class ChanAlgorithm : public AConvexHullStrategy<T> {
+public:
+    Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+
+private:
+    MonotoneChainAlgorithm<T> groupStrategy;
+
+    // Group hulls stored back to back; group g spans [groupOffsets[g], groupOffsets[g+1])
+    std::vector<Point<T>> groupHulls;
+    std::vector<size_t> groupOffsets;
+
+    bool wrap(const std::vector<Point<T>>& cloud, size_t groupSize, std::vector<Point<T>>& hull);
+    size_t tangent(size_t begin, size_t end, const Point<T>& from) const;
+    size_t linearTangent(size_t begin, size_t end, const Point<T>& from) const;
+    bool isBetter(const Point<T>& from, const Point<T>& challenger, const Point<T>& incumbent) const;
+};
+
+#endif
@@ -1,154 +1,232 @@
 #include "DivideAndConquerAlgorithm.h"
 #include <algorithm>
-#include <limits>
-#include <cmath>
-#include <type_traits>
+#include <utility>
+
+template<typename T>
+DivideAndConquerAlgorithm<T>::DivideAndConquerAlgorithm(size_t numThreads, size_t grainSize)
+    : grainSize(std::max<size_t>(grainSize, 3)),
+      pool(std::make_unique<WorkStealingPool>(numThreads)),
+      workspace(&ownWorkspace) {}
+
+template<typename T>
+DivideAndConquerAlgorithm<T>::DivideAndConquerAlgorithm(DivideAndConquerAlgorithm&& other) noexcept
+    : AConvexHullStrategy<T>(std::move(other)),
+      grainSize(other.grainSize),
+      pool(std::move(other.pool)),
+      ownWorkspace(std::move(other.ownWorkspace)),
+      workspace(other.workspace == &other.ownWorkspace ? &ownWorkspace : other.workspace) {}
+
+template<typename T>
+DivideAndConquerAlgorithm<T>& DivideAndConquerAlgorithm<T>::operator=(DivideAndConquerAlgorithm&& other) noexcept {
+    if (this != &other) {
+        grainSize = other.grainSize;
+        pool = std::move(other.pool);
+        ownWorkspace = std::move(other.ownWorkspace);
+        workspace = other.workspace == &other.ownWorkspace ? &ownWorkspace : other.workspace;
+    }
+    return *this;
+}
+
+template<typename T>
+void DivideAndConquerAlgorithm<T>::shareWorkspace(HullWorkspace<T>& shared) {
+    workspace = &shared;
+}
 
 template<typename T>
 Poligon<T> DivideAndConquerAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    std::vector<Point<T>> hull;
+    applyInto(cloud, hull);
+    return Poligon<T>(std::move(hull), cloud.size() >= 3);
+}
+
+template<typename T>
+void DivideAndConquerAlgorithm<T>::applyInto(const std::vector<Point<T>>& cloud, std::vector<Point<T>>& hull) {
+    hull.clear();
     if (cloud.size() < 3) {
-        return Poligon<T>(cloud);
+        hull.insert(hull.end(), cloud.begin(), cloud.end());
+        return;
     }
     
-    std::vector<Point<T>> sortedPoints = cloud;
-    std::sort(sortedPoints.begin(), sortedPoints.end(), [](const Point<T>& a, const Point<T>& b) {
-        return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
-    });
+    std::vector<Point<T>>& sortedPoints = workspace->points;
+    sortedPoints.assign(cloud.begin(), cloud.end());
+    sortPoints(sortedPoints, 0, sortedPoints.size());
     
-    std::vector<Point<T>> hullPoints = solve(sortedPoints);
+    std::vector<size_t>& work = workspace->indices;
+    work.resize(2 * sortedPoints.size());
+    size_t hullSize = solve(sortedPoints, work, 0, sortedPoints.size());
     
-    // Ensure the hull is in CCW order
-    Poligon<T> result(hullPoints);
-    if (!result.isCCW() && result.numVertexes() > 2) {
-        result.fromCWToCCW();
+    // Merging keeps the hull CCW, so no orientation fix-up is needed
+    for (size_t i = 0; i < hullSize; ++i) {
+        hull.push_back(sortedPoints[work[i]]);
     }
-
-    return result;
 }
 
+// Parallel merge sort: halves above the grain size are sorted concurrently and merged in place
 template<typename T>
-std::vector<Point<T>> DivideAndConquerAlgorithm<T>::solve(const std::vector<Point<T>>& points) const {
-    int n = points.size();
+void DivideAndConquerAlgorithm<T>::sortPoints(std::vector<Point<T>>& points, size_t begin, size_t end) const {
+    auto lexicographic = [](const Point<T>& a, const Point<T>& b) {
+        return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+    };
     
-    if (n == 1) {
-        return points;
+    if (pool->numThreads() == 1 || end - begin <= grainSize) {
+        std::sort(points.begin() + begin, points.begin() + end, lexicographic);
+        return;
     }
     
-    if (n == 2) {
-        return points;
+    size_t mid = begin + (end - begin) / 2;
+    pool->invoke([&]() { sortPoints(points, begin, mid); },
+                 [&]() { sortPoints(points, mid, end); });
+    std::inplace_merge(points.begin() + begin, points.begin() + mid, points.begin() + end, lexicographic);
+}
+
+template<typename T>
+size_t DivideAndConquerAlgorithm<T>::solve(const std::vector<Point<T>>& points, std::vector<size_t>& work,
+                                          size_t begin, size_t end) const {
+    size_t count = end - begin;
+    size_t* hull = work.data() + begin;
+    
+    if (count == 1) {
+        hull[0] = begin;
+        return 1;
     }
     
-    if (n == 3) {
-        // For 3 points, compute actual convex hull
-        std::vector<Point<T>> result;
-        
-        // Check orientation of the three points
-        Orientation orient = orientation(points[0], points[1], points[2]);
-        
-        if (orient == Orientation::COLLINEAR) {
-            // If collinear, return the two extreme points
-            T dist01 = points[0].dist(points[1]);
-            T dist02 = points[0].dist(points[2]);
-            T dist12 = points[1].dist(points[2]);
-            
-            if (dist01 >= dist02 && dist01 >= dist12) {
-                result.push_back(points[0]);
-                result.push_back(points[1]);
-            } else if (dist02 >= dist01 && dist02 >= dist12) {
-                result.push_back(points[0]);
-                result.push_back(points[2]);
-            } else {
-                result.push_back(points[1]);
-                result.push_back(points[2]);
-            }
-        } else {
-            // If not collinear, return all three points in correct order
-            if (orient == Orientation::COUNTERCLOCKWISE) {
-                result.push_back(points[0]);
-                result.push_back(points[1]);
-                result.push_back(points[2]);
-            } else {
-                result.push_back(points[0]);
-                result.push_back(points[2]);
-                result.push_back(points[1]);
-            }
+    if (count == 2) {
+        hull[0] = begin;
+        if (points[begin] == points[begin + 1]) {
+            return 1;
         }
-        return result;
+        hull[1] = begin + 1;
+        return 2;
     }
     
-    int mid = n / 2;
-    std::vector<Point<T>> leftPoints(points.begin(), points.begin() + mid);
-    std::vector<Point<T>> rightPoints(points.begin() + mid, points.end());
+    if (count == 3) {
+        // Points are sorted, so the first one is the lexicographic minimum
+        switch (OrientationPredicate<T>::orientation(points[begin], points[begin + 1], points[begin + 2])) {
+            case Orientation::COUNTERCLOCKWISE:
+                hull[0] = begin;
+                hull[1] = begin + 1;
+                hull[2] = begin + 2;
+                return 3;
+            case Orientation::CLOCKWISE:
+                hull[0] = begin;
+                hull[1] = begin + 2;
+                hull[2] = begin + 1;
+                return 3;
+            case Orientation::COLLINEAR:
+                // Only the two extremes survive
+                hull[0] = begin;
+                if (points[begin] == points[begin + 2]) {
+                    return 1;
+                }
+                hull[1] = begin + 2;
+                return 2;
+        }
+    }
     
-    std::vector<Point<T>> leftHull = solve(leftPoints);
-    std::vector<Point<T>> rightHull = solve(rightPoints);
+    // Both halves write to disjoint ranges of work, so they can run concurrently
+    size_t mid = begin + count / 2;
+    size_t leftSize = 0;
+    size_t rightSize = 0;
+    if (count > grainSize && pool->numThreads() > 1) {
+        pool->invoke([&]() { leftSize = solve(points, work, begin, mid); },
+                     [&]() { rightSize = solve(points, work, mid, end); });
+    } else {
+        leftSize = solve(points, work, begin, mid);
+        rightSize = solve(points, work, mid, end);
+    }
     
-    return merge(leftHull, rightHull);
+    return merge(points, work, begin, leftSize, mid, rightSize);
 }
 
 template<typename T>
-std::vector<Point<T>> DivideAndConquerAlgorithm<T>::merge(const std::vector<Point<T>>& leftHull, std::vector<Point<T>>& rightHull) const {
-    // For now, use a simpler approach: combine both hulls and use Graham scan-like approach
-    std::vector<Point<T>> combined;
-    combined.insert(combined.end(), leftHull.begin(), leftHull.end());
-    combined.insert(combined.end(), rightHull.begin(), rightHull.end());
-    
-    if (combined.size() <= 3) {
-        return combined;
-    }
+size_t DivideAndConquerAlgorithm<T>::merge(const std::vector<Point<T>>& points, std::vector<size_t>& work,
+                                          size_t begin, size_t leftSize, size_t mid, size_t rightSize) const {
+    const size_t* left = work.data() + begin;
+    const size_t* right = work.data() + mid;
+    auto L = [&](size_t i) -> const Point<T>& { return points[left[i]]; };
+    auto R = [&](size_t j) -> const Point<T>& { return points[right[j]]; };
     
-    // Find the bottom-most point (and leftmost if tie)
-    size_t bottom = 0;
-    for (size_t i = 1; i < combined.size(); i++) {
-        if (combined[i].getY() < combined[bottom].getY() || 
-            (combined[i].getY() == combined[bottom].getY() && combined[i].getX() < combined[bottom].getX())) {
-            bottom = i;
+    // Both walks start from the facing extremes: the rightmost left vertex and the
+    // leftmost right vertex (index 0)
+    size_t rightmost = 0;
+    for (size_t i = 1; i < leftSize; ++i) {
+        if (left[i] > left[rightmost]) {
+            rightmost = i;
         }
     }
-    std::swap(combined[0], combined[bottom]);
-    
-    // Sort points by polar angle with respect to bottom point
-    Point<T> pivot = combined[0];
-    std::sort(combined.begin() + 1, combined.end(), [&](const Point<T>& a, const Point<T>& b) {
-        Orientation orient = orientation(pivot, a, b);
-        if (orient == Orientation::COLLINEAR) {
-            // If collinear, prefer the one closer to pivot
-            return pivot.dist(a) < pivot.dist(b);
+    
+    // Collinear candidates are taken only when they lie farther out, so the tangents
+    // always end on extreme vertices
+    auto advances = [&](const Point<T>& pivot, const Point<T>& anchor, const Point<T>& current,
+                        const Point<T>& candidate, Orientation outward) {
+        Orientation orient = OrientationPredicate<T>::orientation(pivot, anchor, candidate);
+        if (orient == outward) return true;
+        return orient == Orientation::COLLINEAR &&
+               OrientationPredicate<T>::squaredDistance(pivot, candidate) > OrientationPredicate<T>::squaredDistance(pivot, current);
+    };
+    
+    // Lower tangent: walk the left hull clockwise and the right hull counterclockwise
+    size_t lowerLeft = rightmost;
+    size_t lowerRight = 0;
+    for (bool moved = true; moved;) {
+        moved = false;
+        while (leftSize > 1) {
+            size_t prev = (lowerLeft + leftSize - 1) % leftSize;
+            if (!advances(R(lowerRight), L(lowerLeft), L(lowerLeft), L(prev), Orientation::COUNTERCLOCKWISE)) break;
+            lowerLeft = prev;
+            moved = true;
         }
-        return orient == Orientation::COUNTERCLOCKWISE;
-    });
+        while (rightSize > 1) {
+            size_t next = (lowerRight + 1) % rightSize;
+            if (!advances(L(lowerLeft), R(lowerRight), R(lowerRight), R(next), Orientation::CLOCKWISE)) break;
+            lowerRight = next;
+            moved = true;
+        }
+    }
     
-    // Build convex hull using Graham scan
-    std::vector<Point<T>> hull;
-    for (const auto& point : combined) {
-        while (hull.size() > 1 && 
-                orientation(hull[hull.size()-2], hull[hull.size()-1], point) != Orientation::COUNTERCLOCKWISE) {
-            hull.pop_back();
+    // Upper tangent: walk the left hull counterclockwise and the right hull clockwise
+    size_t upperLeft = rightmost;
+    size_t upperRight = 0;
+    for (bool moved = true; moved;) {
+        moved = false;
+        while (leftSize > 1) {
+            size_t next = (upperLeft + 1) % leftSize;
+            if (!advances(R(upperRight), L(upperLeft), L(upperLeft), L(next), Orientation::CLOCKWISE)) break;
+            upperLeft = next;
+            moved = true;
+        }
+        while (rightSize > 1) {
+            size_t prev = (upperRight + rightSize - 1) % rightSize;
+            if (!advances(L(upperLeft), R(upperRight), R(upperRight), R(prev), Orientation::COUNTERCLOCKWISE)) break;
+            upperRight = prev;
+            moved = true;
         }
-        hull.push_back(point);
     }
     
-    return hull;
-}
-
-template<typename T>
-Orientation DivideAndConquerAlgorithm<T>::orientation(const Point<T>& current, const Point<T>& aspirant, const Point<T>& challenger) const {
-    Vector<T> v1(aspirant.getX() - current.getX(), aspirant.getY() - current.getY());
-    Vector<T> v2(challenger.getX() - current.getX(), challenger.getY() - current.getY());
-    Vector<T> cross = v1.cross(v2);
+    // CCW from the left minimum: left lower chain, right hull between the tangents,
+    // then the left upper chain back to the start
+    size_t* merged = work.data() + (work.size() / 2) + begin;
+    size_t size = 0;
+    for (size_t i = 0; i <= lowerLeft; ++i) {
+        merged[size++] = left[i];
+    }
+    for (size_t j = lowerRight;; j = (j + 1) % rightSize) {
+        merged[size++] = right[j];
+        if (j == upperRight) break;
+    }
+    if (upperLeft != 0) {
+        for (size_t i = (upperLeft == lowerLeft) ? upperLeft + 1 : upperLeft; i < leftSize; ++i) {
+            merged[size++] = left[i];
+        }
+    }
     
-    if (isZero(cross.getZ())) return Orientation::COLLINEAR;
-    return (cross.getZ() < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
-}
-
-// Helper method for flexible zero comparison
-template<typename T>
-bool DivideAndConquerAlgorithm<T>::isZero(T value) const {
-    if constexpr (std::is_floating_point_v<T>) {
-        return std::abs(value) < std::numeric_limits<T>::epsilon() * 10;
-    } else {
-        return value == 0;
+    // Clouds of one repeated point collapse to a single vertex
+    if (size == 2 && points[merged[0]] == points[merged[1]]) {
+        size = 1;
     }
+    
+    std::copy(merged, merged + size, work.data() + begin);
+    return size;
 }
 
 // Explicit template instantiations
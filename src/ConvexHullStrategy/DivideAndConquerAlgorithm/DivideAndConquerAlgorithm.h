@@ -2,21 +2,44 @@
 #define ADIVIDEANDCONQUERALGORITHM_H
 
 #include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <memory>
 #include <vector>
 #include "Poligon/Poligon.h"
 #include "Point/Point.h"
-#include "ConvexHullStrategy/Orientation.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ConvexHullStrategy/HullWorkspace/HullWorkspace.h"
+#include "ThreadPool/WorkStealingPool.h"
 
 template<typename T>
 class DivideAndConquerAlgorithm : public AConvexHullStrategy<T> {
 public:
+    // With numThreads > 1 the two halves of every subproblem larger than grainSize points
+    // (and the initial sort) run in parallel; the default stays sequential
+    explicit DivideAndConquerAlgorithm(size_t numThreads = 1, size_t grainSize = 16384);
+
     Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+    void applyInto(const std::vector<Point<T>>& cloud, std::vector<Point<T>>& hull) override;
+
+    // A moved strategy keeps a shared workspace and takes over its own one, which it then
+    // points at; the moved-from strategy can only be destroyed or assigned to
+    DivideAndConquerAlgorithm(DivideAndConquerAlgorithm&& other) noexcept;
+    DivideAndConquerAlgorithm& operator=(DivideAndConquerAlgorithm&& other) noexcept;
+
+    // Scratch buffers come from shared instead of the strategy's own workspace from now on
+    void shareWorkspace(HullWorkspace<T>& shared);
 
 private:
-    std::vector<Point<T>> solve(const std::vector<Point<T>>& points) const;
-    std::vector<Point<T>> merge(const std::vector<Point<T>>& leftHull, std::vector<Point<T>>& rightHull) const;
-    Orientation orientation(const Point<T>& current, const Point<T>& aspirant, const Point<T>& challenger) const;
-    bool isZero(T value) const;
+    size_t grainSize;
+    std::unique_ptr<WorkStealingPool> pool;
+    HullWorkspace<T> ownWorkspace;
+    HullWorkspace<T>* workspace;
+
+    void sortPoints(std::vector<Point<T>>& points, size_t begin, size_t end) const;
+    // work holds 2n indices into points: the hull of points[begin, end) is kept CCW from its
+    // lexicographic minimum in work[begin, ...), and work[n + begin, n + end) is merge scratch
+    size_t solve(const std::vector<Point<T>>& points, std::vector<size_t>& work, size_t begin, size_t end) const;
+    size_t merge(const std::vector<Point<T>>& points, std::vector<size_t>& work,
+                 size_t begin, size_t leftSize, size_t mid, size_t rightSize) const;
 };
 
 #endif
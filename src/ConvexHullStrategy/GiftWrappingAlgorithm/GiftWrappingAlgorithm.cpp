@@ -1,69 +1,214 @@
 #include "GiftWrappingAlgorithm.h"
-#include "Vector/Vector.h"
-#include <limits>
+#include <algorithm>
 #include <cmath>
-#include <type_traits>
+#include <utility>
+
+template<typename T>
+GiftWrappingAlgorithm<T>::GiftWrappingAlgorithm(size_t numThreads, size_t parallelCutoff)
+    : parallelCutoff(std::max<size_t>(parallelCutoff, 1)),
+      pool(std::make_unique<WorkStealingPool>(numThreads)),
+      workspace(&ownWorkspace) {}
+
+template<typename T>
+GiftWrappingAlgorithm<T>::GiftWrappingAlgorithm(GiftWrappingAlgorithm&& other) noexcept
+    : AConvexHullStrategy<T>(std::move(other)),
+      parallelCutoff(other.parallelCutoff),
+      pool(std::move(other.pool)),
+      ownWorkspace(std::move(other.ownWorkspace)),
+      workspace(other.workspace == &other.ownWorkspace ? &ownWorkspace : other.workspace) {}
+
+template<typename T>
+GiftWrappingAlgorithm<T>& GiftWrappingAlgorithm<T>::operator=(GiftWrappingAlgorithm&& other) noexcept {
+    if (this != &other) {
+        parallelCutoff = other.parallelCutoff;
+        pool = std::move(other.pool);
+        ownWorkspace = std::move(other.ownWorkspace);
+        workspace = other.workspace == &other.ownWorkspace ? &ownWorkspace : other.workspace;
+    }
+    return *this;
+}
+
+template<typename T>
+void GiftWrappingAlgorithm<T>::shareWorkspace(HullWorkspace<T>& shared) {
+    workspace = &shared;
+}
 
 template<typename T>
 Poligon<T> GiftWrappingAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    std::vector<Point<T>> hull;
+    applyInto(cloud, hull);
+    return Poligon<T>(std::move(hull), cloud.size() > 3);
+}
+
+template<typename T>
+void GiftWrappingAlgorithm<T>::applyInto(const std::vector<Point<T>>& cloud, std::vector<Point<T>>& hull) {
+    hull.clear();
     if (cloud.size() <= 3) {
-        return Poligon<T>(cloud);
+        hull.insert(hull.end(), cloud.begin(), cloud.end());
+        return;
     }
 
-    std::vector<Point<T>> sortedPoints = cloud;
+    std::vector<Point<T>>& sortedPoints = workspace->points;
+    sortedPoints.assign(cloud.begin(), cloud.end());
     std::sort(sortedPoints.begin(), sortedPoints.end(), [](const Point<T>& a, const Point<T>& b) {
         return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
     });
     
-    std::vector<Point<T>> hull;
+    // Coordinates are scanned as two flat arrays so batches load straight into vector registers
+    std::vector<T>& xs = workspace->xs;
+    std::vector<T>& ys = workspace->ys;
+    xs.resize(sortedPoints.size());
+    ys.resize(sortedPoints.size());
+    for (size_t i = 0; i < sortedPoints.size(); i++) {
+        xs[i] = sortedPoints[i].getX();
+        ys[i] = sortedPoints[i].getY();
+    }
+    
+    // Every coordinate difference taken during the wrap is bounded by the cloud's extent, which
+    // decides whether integer lanes are exact in 64 bits
+    auto [minY, maxY] = std::minmax_element(ys.begin(), ys.end());
+    Lane span = std::max(Lane(xs.back()) - Lane(xs.front()), Lane(*maxY) - Lane(*minY));
     
     size_t currentId = 0;
     
     do {
         hull.push_back(sortedPoints[currentId]);
+        size_t nextId = nextVertex(xs, ys, span, currentId, (currentId + 1) % sortedPoints.size());
         
-        size_t nextId = (currentId + 1) % sortedPoints.size();
-        
-        // Find the most counterclockwise point
-        for (size_t i = 0; i < sortedPoints.size(); i++) {
-            switch (orientation(sortedPoints[currentId], sortedPoints[nextId], sortedPoints[i])) {
-                case Orientation::COUNTERCLOCKWISE:
-                    nextId = i;
-                    break;
-                case Orientation::COLLINEAR:
-                    if (sortedPoints[currentId].dist(sortedPoints[i]) > sortedPoints[currentId].dist(sortedPoints[nextId])) {
-                        nextId = i;
-                    }
-                    break;
-                case Orientation::CLOCKWISE:
-                    break;
-            }
-        }
-        
+        // Only a cloud of one repeated point has no vertex away from the current one
+        if (sortedPoints[nextId] == sortedPoints[currentId]) break;
         currentId = nextId;
     } while (currentId != 0);
-    
-    return Poligon<T>(hull);
+
+    // The wrap keeps the most counterclockwise candidate, so it walks the hull clockwise;
+    // reversing all but the lexicographic minimum gives the CCW order the other strategies return
+    std::reverse(hull.begin() + 1, hull.end());
 }
 
+// Most counterclockwise point as seen from current, reduced in parallel over contiguous chunks
 template<typename T>
-Orientation GiftWrappingAlgorithm<T>::orientation(const Point<T>& current, const Point<T>& aspirant, const Point<T>& challenger) const {
-    Vector<T> v1(aspirant.getX() - current.getX(), aspirant.getY() - current.getY());
-    Vector<T> v2(challenger.getX() - current.getX(), challenger.getY() - current.getY());
-    Vector<T> cross = v1.cross(v2);
+size_t GiftWrappingAlgorithm<T>::nextVertex(const std::vector<T>& xs, const std::vector<T>& ys, Lane span,
+                                            size_t current, size_t incumbent) const {
+    size_t n = xs.size();
+    if (pool->numThreads() == 1 || n <= parallelCutoff) {
+        return scan(xs, ys, span, current, incumbent, 0, n);
+    }
     
-    if (isZero(cross.getZ())) return Orientation::COLLINEAR;
-    return (cross.getZ() < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+    size_t chunks = pool->numThreads() * 4;
+    std::vector<size_t>& winners = workspace->indices;
+    winners.resize(chunks);
+    pool->parallelFor(0, chunks, 1, [&](size_t chunkBegin, size_t chunkEnd) {
+        for (size_t c = chunkBegin; c < chunkEnd; c++) {
+            winners[c] = scan(xs, ys, span, current, incumbent, c * n / chunks, (c + 1) * n / chunks);
+        }
+    });
+    
+    size_t best = incumbent;
+    for (size_t winner : winners) {
+        if (isBetter(xs, ys, current, winner, best)) {
+            best = winner;
+        }
+    }
+    return best;
 }
 
-// Helper method for flexible zero comparison
+// Each lane keeps its own incumbent, so a batch is compared against LANES independent
+// candidates with no branches; the lanes are reduced with the exact rule at the end. A float
+// cross product inside Shewchuk's rounding bound only raises a flag, and a flagged range is
+// rescanned with the exact predicate. Integers are exact in 64 bits unless the cloud spans
+// 2^31 or more, in which case the exact scan runs directly
 template<typename T>
-bool GiftWrappingAlgorithm<T>::isZero(T value) const {
-    if constexpr (std::is_floating_point_v<T>) {
-        return std::abs(value) < std::numeric_limits<T>::epsilon() * 10;
-    } else {
-        return value == 0;
+size_t GiftWrappingAlgorithm<T>::scan(const std::vector<T>& xs, const std::vector<T>& ys, Lane span,
+                                      size_t current, size_t incumbent, size_t begin, size_t end) const {
+    auto exactScan = [&]() {
+        size_t best = incumbent;
+        for (size_t j = begin; j < end; j++) {
+            if (isBetter(xs, ys, current, j, best)) {
+                best = j;
+            }
+        }
+        return best;
+    };
+    
+    if constexpr (std::is_integral_v<T>) {
+        if (span >= (Lane(1) << 31)) return exactScan();
+    }
+    
+    const T* px = xs.data();
+    const T* py = ys.data();
+    const Lane cx = px[current];
+    const Lane cy = py[current];
+    
+    T bestX[LANES];
+    T bestY[LANES];
+    size_t bestId[LANES];
+    for (size_t lane = 0; lane < LANES; lane++) {
+        bestX[lane] = px[incumbent];
+        bestY[lane] = py[incumbent];
+        bestId[lane] = incumbent;
     }
+    
+    bool uncertain = false;
+    auto step = [&](size_t lane, size_t i) {
+        Lane ax = Lane(bestX[lane]) - cx;
+        Lane ay = Lane(bestY[lane]) - cy;
+        Lane bx = Lane(px[i]) - cx;
+        Lane by = Lane(py[i]) - cy;
+        Lane left = ax * by;
+        Lane right = ay * bx;
+        Lane cross = left - right;
+        // Bitwise operators keep the selection branch-free so the lane loop vectorizes
+        bool take;
+        if constexpr (std::is_floating_point_v<T>) {
+            // A zero between distinct points is inside the bound too, so collinear ties always
+            // go to the exact rescan and the lanes never need distances. The incumbent meeting
+            // itself (or a duplicate) and the current point are the zeros that are not doubtful
+            Lane bound = OrientationPredicate<T>::ERROR_BOUND * (std::abs(left) + std::abs(right));
+            uncertain |= (std::abs(cross) <= bound) & ((ax != bx) | (ay != by)) & ((bx != 0) | (by != 0));
+            take = cross > 0;
+        } else {
+            // Squared distances order collinear candidates the same way dist() would, without sqrt
+            take = (cross > 0) | ((cross == 0) & (bx * bx + by * by > ax * ax + ay * ay));
+        }
+        bestX[lane] = take ? px[i] : bestX[lane];
+        bestY[lane] = take ? py[i] : bestY[lane];
+        bestId[lane] = take ? i : bestId[lane];
+    };
+    
+    size_t i = begin;
+    for (; i + LANES <= end; i += LANES) {
+        for (size_t lane = 0; lane < LANES; lane++) {
+            step(lane, i + lane);
+        }
+    }
+    for (size_t lane = 0; i < end; i++, lane++) {
+        step(lane, i);
+    }
+    
+    if (uncertain) return exactScan();
+    
+    size_t best = incumbent;
+    for (size_t lane = 0; lane < LANES; lane++) {
+        if (isBetter(xs, ys, current, bestId[lane], best)) {
+            best = bestId[lane];
+        }
+    }
+    return best;
+}
+
+// Counterclockwise wins; among collinear points the farther one, then the lower index so
+// duplicates of the starting point always close the wrap
+template<typename T>
+bool GiftWrappingAlgorithm<T>::isBetter(const std::vector<T>& xs, const std::vector<T>& ys, size_t current,
+                                        size_t challenger, size_t incumbent) const {
+    int turn = OrientationPredicate<T>::sign(xs[current], ys[current], xs[incumbent], ys[incumbent],
+                                             xs[challenger], ys[challenger]);
+    if (turn != 0) return turn > 0;
+    
+    Point<T> from(xs[current], ys[current]);
+    auto challengerDist = OrientationPredicate<T>::squaredDistance(from, Point<T>(xs[challenger], ys[challenger]));
+    auto incumbentDist = OrientationPredicate<T>::squaredDistance(from, Point<T>(xs[incumbent], ys[incumbent]));
+    return challengerDist > incumbentDist || (challengerDist == incumbentDist && challenger < incumbent);
 }
 
 // Explicit template instantiation for common types
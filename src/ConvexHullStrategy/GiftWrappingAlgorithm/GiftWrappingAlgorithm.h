@@ -2,19 +2,51 @@
 #define GIFTWRAPPINGALGORITHM_H
 
 #include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <cstdint>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include "Poligon/Poligon.h"
 #include "Point/Point.h"
-#include "ConvexHullStrategy/Orientation.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ConvexHullStrategy/HullWorkspace/HullWorkspace.h"
+#include "ThreadPool/WorkStealingPool.h"
 
 template<typename T>
 class GiftWrappingAlgorithm : public AConvexHullStrategy<T> {
 public:
+    // Candidate scans over more than parallelCutoff points are split across numThreads threads
+    explicit GiftWrappingAlgorithm(size_t numThreads = 1, size_t parallelCutoff = 32768);
+
     Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+    void applyInto(const std::vector<Point<T>>& cloud, std::vector<Point<T>>& hull) override;
+
+    // A moved strategy keeps a shared workspace and takes over its own one, which it then
+    // points at; the moved-from strategy can only be destroyed or assigned to
+    GiftWrappingAlgorithm(GiftWrappingAlgorithm&& other) noexcept;
+    GiftWrappingAlgorithm& operator=(GiftWrappingAlgorithm&& other) noexcept;
+
+    // Scratch buffers come from shared instead of the strategy's own workspace from now on
+    void shareWorkspace(HullWorkspace<T>& shared);
 
 private:
-    Orientation orientation(const Point<T>& current, const Point<T>& aspirant, const Point<T>& challenger) const;
-    bool isZero(T value) const;
+    // One 256-bit (AVX2) register worth of coordinates per batch
+    static constexpr size_t LANES = 32 / sizeof(T);
+    // Lane arithmetic: floats stay in T behind an error filter, integers widen to 64 bits
+    using Lane = std::conditional_t<std::is_floating_point_v<T>, T, int64_t>;
+
+    size_t parallelCutoff;
+    std::unique_ptr<WorkStealingPool> pool;
+    HullWorkspace<T> ownWorkspace;
+    HullWorkspace<T>* workspace;
+
+    // span bounds every coordinate difference in the cloud
+    size_t nextVertex(const std::vector<T>& xs, const std::vector<T>& ys, Lane span,
+                      size_t current, size_t incumbent) const;
+    size_t scan(const std::vector<T>& xs, const std::vector<T>& ys, Lane span, size_t current, size_t incumbent,
+                size_t begin, size_t end) const;
+    bool isBetter(const std::vector<T>& xs, const std::vector<T>& ys, size_t current,
+                  size_t challenger, size_t incumbent) const;
 };
 
 #endif
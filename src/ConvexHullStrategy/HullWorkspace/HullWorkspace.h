@@ -0,0 +1,23 @@
+#ifndef HULLWORKSPACE_H
+#define HULLWORKSPACE_H
+
+#include <vector>
+#include "Point/Point.h"
+
+// Scratch buffers a strategy keeps between calls. They are cleared but never shrunk, so once
+// a strategy has seen its largest cloud, sequential applyInto() calls do not allocate. That
+// holds for strategies built with one thread: with more, the tasks handed to the pool (the
+// parallel gift wrapping scans, the divide and conquer halves) still allocate their closures.
+// One workspace can be shared by several strategies as long as they run on the same thread
+template<typename T>
+struct HullWorkspace {
+    // Sorted copy of the cloud
+    std::vector<Point<T>> points;
+    // The same cloud as coordinate columns
+    std::vector<T> xs;
+    std::vector<T> ys;
+    // Index bookkeeping (hull stacks, merge buffers, per-chunk winners)
+    std::vector<size_t> indices;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef MONOTONECHAIN_H
+#define MONOTONECHAIN_H
+
+#include <cstddef>
+#include <vector>
+
+// Andrew's monotone chain, shared by everything that hulls points sorted by (x, y). Points are
+// named by their position 0..count-1 in that order, so callers keep them in whatever layout
+// suits them: turnsLeft(a, b, c) is the strict CCW test on three positions and same(a, b)
+// whether two positions hold equal points. The hull is left in chain as positions, CCW from
+// position 0 without collinear vertices. count must be at least 1
+struct MonotoneChain {
+    template<typename Index, typename TurnsLeft, typename Same>
+    static void build(size_t count, TurnsLeft turnsLeft, Same same, std::vector<Index>& chain) {
+        chain.clear();
+
+        // Lower chain, left to right
+        for (Index i = 0; i < count; ++i) {
+            while (chain.size() > 1 && !turnsLeft(chain[chain.size()-2], chain[chain.size()-1], i)) {
+                chain.pop_back();
+            }
+            chain.push_back(i);
+        }
+
+        // Upper chain, right to left, never popping into the lower chain
+        size_t lowerSize = chain.size() + 1;
+        for (Index i = static_cast<Index>(count - 1); i-- > 0;) {
+            while (chain.size() >= lowerSize && !turnsLeft(chain[chain.size()-2], chain[chain.size()-1], i)) {
+                chain.pop_back();
+            }
+            chain.push_back(i);
+        }
+
+        // The upper chain closes on the first point
+        chain.pop_back();
+
+        // A cloud of one repeated point collapses to a single vertex
+        if (chain.size() == 2 && same(chain[0], chain[1])) {
+            chain.pop_back();
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include "MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/MonotoneChain/MonotoneChain.h"
+#include <algorithm>
+#include <utility>
+
+template<typename T>
+MonotoneChainAlgorithm<T>::MonotoneChainAlgorithm(bool assumeSorted) : assumeSorted(assumeSorted) {}
+
+template<typename T>
+Poligon<T> MonotoneChainAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    if (cloud.size() < 3) {
+        return Poligon<T>(cloud);
+    }
+
+    auto lexicographic = [](const Point<T>& a, const Point<T>& b) {
+        return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+    };
+
+    // Presorted clouds (e.g. scanline output) are hulled in place with a single pass
+    if (assumeSorted || std::is_sorted(cloud.begin(), cloud.end(), lexicographic)) {
+        return Poligon<T>(chain(cloud), true);
+    }
+
+    std::vector<Point<T>> sortedPoints = cloud;
+    std::sort(sortedPoints.begin(), sortedPoints.end(), lexicographic);
+
+    return Poligon<T>(chain(sortedPoints), true);
+}
+
+template<typename T>
+std::vector<Point<T>> MonotoneChainAlgorithm<T>::chain(const std::vector<Point<T>>& sortedPoints) const {
+    std::vector<size_t> positions;
+    positions.reserve(sortedPoints.size() + 1);
+    MonotoneChain::build(sortedPoints.size(),
+        [&sortedPoints](size_t a, size_t b, size_t c) {
+            return OrientationPredicate<T>::orientation(sortedPoints[a], sortedPoints[b], sortedPoints[c]) ==
+                   Orientation::COUNTERCLOCKWISE;
+        },
+        [&sortedPoints](size_t a, size_t b) { return sortedPoints[a] == sortedPoints[b]; },
+        positions);
+
+    std::vector<Point<T>> hull;
+    hull.reserve(positions.size());
+    for (size_t position : positions) {
+        hull.push_back(sortedPoints[position]);
+    }
+    return hull;
+}
+
+template<typename T>
+Poligon<T> MonotoneChainAlgorithm<T>::applyCloud(const PointCloud<T>& cloud) {
+    std::vector<size_t> indices;
+    apply(cloud.xs(), cloud.ys(), cloud.size(), indices);
+
+    std::vector<Point<T>> hull;
+    hull.reserve(indices.size());
+    for (size_t index : indices) {
+        hull.push_back(cloud[index]);
+    }
+    return Poligon<T>(std::move(hull), cloud.size() >= 3);
+}
+
+template<typename T>
+void MonotoneChainAlgorithm<T>::apply(const Point<T>* points, size_t count, std::vector<size_t>& hull) {
+    chainIndices([points](size_t i) { return points[i].getX(); },
+                 [points](size_t i) { return points[i].getY(); }, count, hull);
+}
+
+template<typename T>
+void MonotoneChainAlgorithm<T>::apply(const T* xs, const T* ys, size_t count, std::vector<size_t>& hull, size_t stride) {
+    chainIndices([xs, stride](size_t i) { return xs[i * stride]; },
+                 [ys, stride](size_t i) { return ys[i * stride]; }, count, hull);
+}
+
+// The same hull as apply(), without copying the view. One pass finds the leftmost, lowest,
+// rightmost and highest points, and only the points not strictly inside that quadrilateral are
+// gathered as sites and sorted, so a uniform cloud of 10^8 points sorts a few thousand
+template<typename T>
+template<typename X, typename Y>
+void MonotoneChainAlgorithm<T>::chainIndices(X x, Y y, size_t count, std::vector<size_t>& hull) {
+    hull.clear();
+    if (count < 3) {
+        for (size_t i = 0; i < count; ++i) {
+            hull.push_back(i);
+        }
+        return;
+    }
+
+    size_t left = 0, bottom = 0, right = 0, top = 0;
+    for (size_t i = 1; i < count; ++i) {
+        T px = x(i), py = y(i);
+        if (px < x(left) || (px == x(left) && py < y(left))) left = i;
+        if (px > x(right) || (px == x(right) && py > y(right))) right = i;
+        if (py < y(bottom) || (py == y(bottom) && px > x(bottom))) bottom = i;
+        if (py > y(top) || (py == y(top) && px < x(top))) top = i;
+    }
+
+    // CCW corners; repeated corners leave a zero-length edge and nothing is strictly inside
+    const size_t corners[4] = {left, bottom, right, top};
+    sites.clear();
+    for (size_t i = 0; i < count; ++i) {
+        T px = x(i), py = y(i);
+        bool inside = true;
+        for (int k = 0; k < 4 && inside; ++k) {
+            size_t a = corners[k], b = corners[(k + 1) % 4];
+            inside = OrientationPredicate<T>::sign(x(a), y(a), x(b), y(b), px, py) > 0;
+        }
+        if (!inside) {
+            sites.push_back({px, py, i});
+        }
+    }
+
+    auto lexicographic = [](const Site& a, const Site& b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    };
+    if (!assumeSorted && !std::is_sorted(sites.begin(), sites.end(), lexicographic)) {
+        std::sort(sites.begin(), sites.end(), lexicographic);
+    }
+
+    // Chain over positions in sites, translated to the caller's indices at the end
+    MonotoneChain::build(sites.size(),
+        [this](size_t a, size_t b, size_t c) {
+            return OrientationPredicate<T>::sign(sites[a].x, sites[a].y, sites[b].x, sites[b].y,
+                                                 sites[c].x, sites[c].y) > 0;
+        },
+        [this](size_t a, size_t b) { return sites[a].x == sites[b].x && sites[a].y == sites[b].y; },
+        hull);
+
+    for (size_t& vertex : hull) {
+        vertex = sites[vertex].index;
+    }
+}
+
+// Explicit template instantiations
+template class MonotoneChainAlgorithm<int>;
+template class MonotoneChainAlgorithm<float>;
+template class MonotoneChainAlgorithm<double>;
@@ -0,0 +1,45 @@
+#ifndef MONOTONECHAINALGORITHM_H
+#define MONOTONECHAINALGORITHM_H
+
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+template<typename T>
+class MonotoneChainAlgorithm : public AConvexHullStrategy<T> {
+public:
+    // With assumeSorted the caller guarantees the cloud is already ordered by (x, y)
+    // and both the sort and the linear sortedness check are skipped.
+    explicit MonotoneChainAlgorithm(bool assumeSorted = false);
+
+    Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+    // Reads the x and y columns in place through the zero-copy overload below
+    Poligon<T> applyCloud(const PointCloud<T>& cloud) override;
+
+    // Zero-copy inputs: points stay in the caller's buffer and the hull comes back as indices
+    // into it, with the same vertices and order as apply(). count points starting at points
+    void apply(const Point<T>* points, size_t count, std::vector<size_t>& hull);
+    // Point i is (xs[i * stride], ys[i * stride]): separate columns use stride 1, and an
+    // interleaved x, y buffer passes ys = xs + 1 with stride 2
+    void apply(const T* xs, const T* ys, size_t count, std::vector<size_t>& hull, size_t stride = 1);
+
+private:
+    bool assumeSorted;
+
+    // A viewed point that may be on the hull, by its position in the caller's buffer
+    struct Site {
+        T x;
+        T y;
+        size_t index;
+    };
+    // Kept between calls so repeated views do not allocate
+    std::vector<Site> sites;
+
+    std::vector<Point<T>> chain(const std::vector<Point<T>>& sortedPoints) const;
+    template<typename X, typename Y>
+    void chainIndices(X x, Y y, size_t count, std::vector<size_t>& hull);
+};
+
+#endif
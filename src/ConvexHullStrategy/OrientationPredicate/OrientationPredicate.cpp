@@ -0,0 +1,75 @@
+#include "OrientationPredicate.h"
+
+template<typename T>
+std::atomic<size_t> OrientationPredicate<T>::slowPaths{0};
+
+template<typename T>
+size_t OrientationPredicate<T>::slowPathCount() {
+    return slowPaths.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void OrientationPredicate<T>::resetSlowPathCount() {
+    slowPaths.store(0, std::memory_order_relaxed);
+}
+
+// The cross product expands to six coordinate products (the ax * ay terms cancel)
+template<typename T>
+int OrientationPredicate<T>::exactSign(double ax, double ay, double bx, double by, double cx, double cy) {
+    slowPaths.fetch_add(1, std::memory_order_relaxed);
+
+    const double factors[6][2] = {
+        {bx, cy}, {-bx, ay}, {-ax, cy}, {-by, cx}, {by, ax}, {ay, cx}
+    };
+    return productSumSign(factors, 6);
+}
+
+// (t - f) x (a - b) expands to eight coordinate products
+template<typename T>
+int OrientationPredicate<T>::exactCompareCross(double fx, double fy, double tx, double ty,
+                                               double ax, double ay, double bx, double by) {
+    slowPaths.fetch_add(1, std::memory_order_relaxed);
+
+    const double factors[8][2] = {
+        {tx, ay}, {-tx, by}, {-fx, ay}, {fx, by}, {-ty, ax}, {ty, bx}, {fy, ax}, {-fy, bx}
+    };
+    return productSumSign(factors, 8);
+}
+
+// Each product is split exactly into a rounded value and its error with fma, and the terms
+// are summed into a nonoverlapping expansion whose largest component carries the sign
+template<typename T>
+int OrientationPredicate<T>::productSumSign(const double (*factors)[2], size_t count) {
+    double expansion[16];
+    size_t size = 0;
+    auto grow = [&](double value) {
+        double q = value;
+        for (size_t i = 0; i < size; ++i) {
+            // Two-sum: q + expansion[i] == sum + error exactly
+            double sum = q + expansion[i];
+            double virtualQ = sum - expansion[i];
+            double virtualE = sum - virtualQ;
+            double error = (q - virtualQ) + (expansion[i] - virtualE);
+            expansion[i] = error;
+            q = sum;
+        }
+        expansion[size++] = q;
+    };
+
+    for (size_t f = 0; f < count; ++f) {
+        double product = factors[f][0] * factors[f][1];
+        grow(std::fma(factors[f][0], factors[f][1], -product));
+        grow(product);
+    }
+
+    for (size_t i = size; i-- > 0;) {
+        if (expansion[i] > 0) return 1;
+        if (expansion[i] < 0) return -1;
+    }
+    return 0;
+}
+
+// Explicit template instantiations
+template class OrientationPredicate<int>;
+template class OrientationPredicate<float>;
+template class OrientationPredicate<double>;
@@ -0,0 +1,122 @@
+#ifndef ORIENTATIONPREDICATE_H
+#define ORIENTATIONPREDICATE_H
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Point/Point.h"
+#include "ConvexHullStrategy/Orientation.h"
+
+// Exact sign of the turn a -> b -> c, shared by every 2D strategy. Integers are evaluated
+// in 128 bits and floats in double, which is exact for both. Doubles go through Shewchuk's
+// static filter and fall back to exact expansion arithmetic only when the rounded cross
+// product is too small to trust
+template<typename T>
+class OrientationPredicate {
+public:
+    static Orientation orientation(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+        return toOrientation(sign(a.getX(), a.getY(), b.getX(), b.getY(), c.getX(), c.getY()));
+    }
+
+    // Integer kernels: coordinate differences are exact in 64 bits and their products in 128,
+    // so every quantity below is exact for any int input. Floating point stays in T
+    using Diff = std::conditional_t<std::is_integral_v<T>, int64_t, T>;
+    using Wide = std::conditional_t<std::is_integral_v<T>, __int128, T>;
+
+    // Twice the signed area of (from, to, point), positive when point is left of from->to
+    static Wide cross(const Point<T>& from, const Point<T>& to, const Point<T>& point) {
+        return Wide(Diff(to.getX()) - from.getX()) * (Diff(point.getY()) - from.getY())
+             - Wide(Diff(to.getY()) - from.getY()) * (Diff(point.getX()) - from.getX());
+    }
+
+    // (to - from) . (point - from), how far point lies along from->to
+    static Wide dot(const Point<T>& from, const Point<T>& to, const Point<T>& point) {
+        return Wide(Diff(to.getX()) - from.getX()) * (Diff(point.getX()) - from.getX())
+             + Wide(Diff(to.getY()) - from.getY()) * (Diff(point.getY()) - from.getY());
+    }
+
+    // Orders points by distance like dist() without the square root
+    static Wide squaredDistance(const Point<T>& a, const Point<T>& b) {
+        Wide dx = Diff(b.getX()) - a.getX();
+        Wide dy = Diff(b.getY()) - a.getY();
+        return dx * dx + dy * dy;
+    }
+
+    // 1 when counterclockwise, -1 when clockwise, 0 when collinear
+    static int sign(T ax, T ay, T bx, T by, T cx, T cy) {
+        if constexpr (std::is_integral_v<T>) {
+            Wide left = Wide(Diff(bx) - ax) * (Diff(cy) - ay);
+            Wide right = Wide(Diff(by) - ay) * (Diff(cx) - ax);
+            return (left > right) - (left < right);
+        } else if constexpr (std::is_same_v<T, float>) {
+            // Float differences and their products are exact in double
+            double left = (double(bx) - ax) * (double(cy) - ay);
+            double right = (double(by) - ay) * (double(cx) - ax);
+            return (left > right) - (left < right);
+        } else {
+            double left = (double(bx) - ax) * (double(cy) - ay);
+            double right = (double(by) - ay) * (double(cx) - ax);
+            double det = left - right;
+            double bound = ERROR_BOUND * (std::abs(left) + std::abs(right));
+            if (det > bound) return 1;
+            if (-det > bound) return -1;
+            // Both products vanish only when a difference is exactly zero
+            if (bound == 0) return 0;
+            return exactSign(ax, ay, bx, by, cx, cy);
+        }
+    }
+
+    // Sign of cross(from, to, a) - cross(from, to, b): which of a and b lies farther left of
+    // from->to. Rounded crosses of two nearly equally distant points can tie or swap, so floats
+    // get the same filter and exact fallback as sign()
+    static int compareCross(const Point<T>& from, const Point<T>& to, const Point<T>& a, const Point<T>& b) {
+        if constexpr (std::is_integral_v<T>) {
+            Wide left = cross(from, to, a);
+            Wide right = cross(from, to, b);
+            return (left > right) - (left < right);
+        } else {
+            double ex = double(to.getX()) - double(from.getX());
+            double ey = double(to.getY()) - double(from.getY());
+            double leftA = ex * (double(a.getY()) - double(from.getY()));
+            double rightA = ey * (double(a.getX()) - double(from.getX()));
+            double leftB = ex * (double(b.getY()) - double(from.getY()));
+            double rightB = ey * (double(b.getX()) - double(from.getX()));
+            double difference = (leftA - rightA) - (leftB - rightB);
+            // Each rounded cross is off by at most its own bound, and the difference adds at
+            // most half of what is left once it exceeds twice their sum
+            double bound = 2 * OrientationPredicate<double>::ERROR_BOUND *
+                           (std::abs(leftA) + std::abs(rightA) + std::abs(leftB) + std::abs(rightB));
+            if (difference > bound) return 1;
+            if (-difference > bound) return -1;
+            return exactCompareCross(from.getX(), from.getY(), to.getX(), to.getY(),
+                                     a.getX(), a.getY(), b.getX(), b.getY());
+        }
+    }
+
+    static Orientation toOrientation(int sign) {
+        if (sign == 0) return Orientation::COLLINEAR;
+        return (sign < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+    }
+
+    // Calls that needed the exact fallback, over all threads since the last reset
+    static size_t slowPathCount();
+    static void resetSlowPathCount();
+
+    // Relative error of a cross product rounded in T (double for integers), (3 + 16 eps) eps,
+    // Shewchuk's ccwerrboundA. Vectorized callers that compute in T filter with it too
+    using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+    static constexpr Real ERROR_BOUND =
+        (3 + 16 * std::numeric_limits<Real>::epsilon()) * std::numeric_limits<Real>::epsilon();
+
+private:
+    static std::atomic<size_t> slowPaths;
+
+    static int exactSign(double ax, double ay, double bx, double by, double cx, double cy);
+    static int exactCompareCross(double fx, double fy, double tx, double ty, double ax, double ay, double bx, double by);
+    // Exact sign of the sum of factors[i][0] * factors[i][1] over count <= 8 products
+    static int productSumSign(const double (*factors)[2], size_t count);
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "QuickHullAlgorithm.h"
+#include <algorithm>
+#include <utility>
+
+template<typename T>
+QuickHullAlgorithm<T>::QuickHullAlgorithm(size_t numThreads, size_t sequentialCutoff)
+    : sequentialCutoff(std::max<size_t>(sequentialCutoff, 1)),
+      pool(std::make_unique<WorkStealingPool>(numThreads)) {}
+
+template<typename T>
+Poligon<T> QuickHullAlgorithm<T>::apply(const std::vector<Point<T>>& cloud) {
+    if (cloud.size() < 3) {
+        return Poligon<T>(cloud);
+    }
+
+    auto lexicographic = [](const Point<T>& a, const Point<T>& b) {
+        return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+    };
+    auto extremes = std::minmax_element(cloud.begin(), cloud.end(), lexicographic);
+    Point<T> leftmost = *extremes.first;
+    Point<T> rightmost = *extremes.second;
+
+    std::vector<Point<T>> hull;
+    hull.push_back(leftmost);
+    if (leftmost == rightmost) {
+        return Poligon<T>(std::move(hull), true);
+    }
+
+    std::vector<Point<T>> below;
+    std::vector<Point<T>> above;
+    partition(cloud, leftmost, rightmost, leftmost, below, above);
+
+    // CCW: leftmost, lower chain, rightmost, upper chain
+    std::vector<Point<T>> lowerChain;
+    std::vector<Point<T>> upperChain;
+    pool->invoke([&]() { findHull(below, leftmost, rightmost, lowerChain); },
+                 [&]() { findHull(above, rightmost, leftmost, upperChain); });
+
+    hull.insert(hull.end(), lowerChain.begin(), lowerChain.end());
+    hull.push_back(rightmost);
+    hull.insert(hull.end(), upperChain.begin(), upperChain.end());
+
+    return Poligon<T>(std::move(hull), true);
+}
+
+// Appends, in order, the hull vertices strictly between from and to; outside holds the
+// points strictly to the right of from->to
+template<typename T>
+void QuickHullAlgorithm<T>::findHull(const std::vector<Point<T>>& outside, const Point<T>& from, const Point<T>& to,
+                                     std::vector<Point<T>>& chain) {
+    if (outside.empty()) {
+        return;
+    }
+
+    Point<T> apex = outside[farthest(outside, from, to)];
+
+    std::vector<Point<T>> first;
+    std::vector<Point<T>> second;
+    partition(outside, from, apex, to, first, second);
+
+    if (outside.size() <= sequentialCutoff) {
+        findHull(first, from, apex, chain);
+        chain.push_back(apex);
+        findHull(second, apex, to, chain);
+        return;
+    }
+
+    std::vector<Point<T>> secondChain;
+    pool->invoke([&]() { findHull(second, apex, to, secondChain); },
+                 [&]() { findHull(first, from, apex, chain); });
+
+    chain.push_back(apex);
+    chain.insert(chain.end(), secondChain.begin(), secondChain.end());
+}
+
+template<typename T>
+size_t QuickHullAlgorithm<T>::farthest(const std::vector<Point<T>>& outside, const Point<T>& from, const Point<T>& to) {
+    auto scan = [&](size_t begin, size_t end) {
+        size_t best = begin;
+        for (size_t i = begin + 1; i < end; ++i) {
+            if (isFarther(from, to, outside[i], outside[best])) {
+                best = i;
+            }
+        }
+        return best;
+    };
+
+    if (outside.size() <= sequentialCutoff) {
+        return scan(0, outside.size());
+    }
+
+    size_t numChunks = (outside.size() + sequentialCutoff - 1) / sequentialCutoff;
+    std::vector<size_t> chunkBest(numChunks);
+    pool->parallelFor(0, numChunks, 1, [&](size_t chunkBegin, size_t chunkEnd) {
+        for (size_t c = chunkBegin; c < chunkEnd; ++c) {
+            chunkBest[c] = scan(c * sequentialCutoff, std::min(outside.size(), (c + 1) * sequentialCutoff));
+        }
+    });
+
+    size_t best = chunkBest[0];
+    for (size_t c = 1; c < numChunks; ++c) {
+        if (isFarther(from, to, outside[chunkBest[c]], outside[best])) {
+            best = chunkBest[c];
+        }
+    }
+    return best;
+}
+
+// Distances are compared exactly, since a rounded comparison can pick a point inside the
+// hull as apex. Ties go to the point furthest along from->to, so the apex is never an interior
+// point of a hull edge parallel to from->to
+template<typename T>
+bool QuickHullAlgorithm<T>::isFarther(const Point<T>& from, const Point<T>& to,
+                                      const Point<T>& challenger, const Point<T>& incumbent) const {
+    int order = OrientationPredicate<T>::compareCross(from, to, challenger, incumbent);
+    if (order != 0) {
+        return order < 0;
+    }
+
+    // An exact tie leaves challenger - incumbent parallel to from->to, so one coordinate decides
+    if (to.getX() != from.getX()) {
+        return challenger.getX() != incumbent.getX() && (challenger.getX() > incumbent.getX()) == (to.getX() > from.getX());
+    }
+    return challenger.getY() != incumbent.getY() && (challenger.getY() > incumbent.getY()) == (to.getY() > from.getY());
+}
+
+template<typename T>
+void QuickHullAlgorithm<T>::partition(const std::vector<Point<T>>& points, const Point<T>& a, const Point<T>& b, const Point<T>& c,
+                                      std::vector<Point<T>>& rightOfAB, std::vector<Point<T>>& rightOfBC) {
+    auto split = [&](size_t begin, size_t end, std::vector<Point<T>>& ab, std::vector<Point<T>>& bc) {
+        for (size_t i = begin; i < end; ++i) {
+            if (isRight(a, b, points[i])) {
+                ab.push_back(points[i]);
+            } else if (isRight(b, c, points[i])) {
+                bc.push_back(points[i]);
+            }
+        }
+    };
+
+    if (points.size() <= sequentialCutoff) {
+        split(0, points.size(), rightOfAB, rightOfBC);
+        return;
+    }
+
+    size_t numChunks = (points.size() + sequentialCutoff - 1) / sequentialCutoff;
+    std::vector<std::vector<Point<T>>> chunkAB(numChunks);
+    std::vector<std::vector<Point<T>>> chunkBC(numChunks);
+    pool->parallelFor(0, numChunks, 1, [&](size_t chunkBegin, size_t chunkEnd) {
+        for (size_t c = chunkBegin; c < chunkEnd; ++c) {
+            split(c * sequentialCutoff, std::min(points.size(), (c + 1) * sequentialCutoff), chunkAB[c], chunkBC[c]);
+        }
+    });
+
+    for (size_t c = 0; c < numChunks; ++c) {
+        rightOfAB.insert(rightOfAB.end(), chunkAB[c].begin(), chunkAB[c].end());
+        rightOfBC.insert(rightOfBC.end(), chunkBC[c].begin(), chunkBC[c].end());
+    }
+}
+
+template<typename T>
+bool QuickHullAlgorithm<T>::isRight(const Point<T>& from, const Point<T>& to, const Point<T>& point) const {
+    return OrientationPredicate<T>::orientation(from, to, point) == Orientation::CLOCKWISE;
+}
+
+// Explicit template instantiations
+template class QuickHullAlgorithm<int>;
+template class QuickHullAlgorithm<float>;
+template class QuickHullAlgorithm<double>;
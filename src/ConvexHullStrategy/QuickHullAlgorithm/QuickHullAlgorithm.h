@@ -0,0 +1,35 @@
+#ifndef QUICKHULLALGORITHM_H
+#define QUICKHULLALGORITHM_H
+
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ThreadPool/WorkStealingPool.h"
+
+template<typename T>
+class QuickHullAlgorithm : public AConvexHullStrategy<T> {
+public:
+    // Subproblems (and scans) smaller than sequentialCutoff points run on the current thread
+    explicit QuickHullAlgorithm(size_t numThreads = std::thread::hardware_concurrency(),
+                                size_t sequentialCutoff = 16384);
+
+    Poligon<T> apply(const std::vector<Point<T>>& cloud) override;
+
+private:
+    size_t sequentialCutoff;
+    std::unique_ptr<WorkStealingPool> pool;
+
+    void findHull(const std::vector<Point<T>>& outside, const Point<T>& from, const Point<T>& to,
+                  std::vector<Point<T>>& chain);
+    size_t farthest(const std::vector<Point<T>>& outside, const Point<T>& from, const Point<T>& to);
+    bool isFarther(const Point<T>& from, const Point<T>& to, const Point<T>& challenger, const Point<T>& incumbent) const;
+    void partition(const std::vector<Point<T>>& points, const Point<T>& a, const Point<T>& b, const Point<T>& c,
+                   std::vector<Point<T>>& rightOfAB, std::vector<Point<T>>& rightOfBC);
+    bool isRight(const Point<T>& from, const Point<T>& to, const Point<T>& point) const;
+};
+
+#endif
@@ -0,0 +1,339 @@
+#include "DynamicConvexHull.h"
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+template<typename T>
+DynamicConvexHull<T>::DynamicConvexHull() : numPoints(0), random(std::random_device{}()) {}
+
+template<typename T>
+void DynamicConvexHull<T>::insert(const Point<T>& point) {
+    insert(root, point);
+    numPoints++;
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::erase(const Point<T>& point) {
+    if (erase(root, point) == Effect::NONE) {
+        return false;
+    }
+    numPoints--;
+    return true;
+}
+
+template<typename T>
+size_t DynamicConvexHull<T>::size() const {
+    return numPoints;
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::empty() const {
+    return numPoints == 0;
+}
+
+template<typename T>
+Poligon<T> DynamicConvexHull<T>::hull() const {
+    std::vector<Point<T>> vertexes;
+    if (!root) {
+        return Poligon<T>(vertexes);
+    }
+    
+    // The lower hull runs from the maximum to the minimum, so read backwards it is the lower
+    // chain from the minimum to the maximum
+    std::vector<Point<T>> lowerChain;
+    std::vector<Point<T>> upperChain;
+    collect(root->lower, lowerChain);
+    collect(root->upper, upperChain);
+    
+    for (auto it = lowerChain.rbegin(); it != lowerChain.rend(); ++it) {
+        vertexes.push_back(*it);
+    }
+    for (size_t i = upperChain.size() - 1; i-- > 1;) {
+        vertexes.push_back(upperChain[i]);
+    }
+    
+    return Poligon<T>(std::move(vertexes), true);
+}
+
+template<typename T>
+typename DynamicConvexHull<T>::Effect DynamicConvexHull<T>::insert(std::unique_ptr<Node>& node, const Point<T>& point) {
+    if (!node) {
+        node = std::make_unique<Node>(Node{point, 1, static_cast<uint32_t>(random()), nullptr, nullptr, nullptr, nullptr});
+        update(*node);
+        return Effect::HULL;
+    }
+    
+    if (point == node->point) {
+        node->copies++;
+        return Effect::POINTS;
+    }
+    
+    bool goesLeft = isLess(point, node->point);
+    std::unique_ptr<Node>& child = goesLeft ? node->left : node->right;
+    Effect effect = insert(child, point);
+    if (child->priority > node->priority) {
+        goesLeft ? rotateRight(node) : rotateLeft(node);
+        return Effect::HULL;
+    }
+    if (effect != Effect::HULL) {
+        return effect;
+    }
+    
+    // An inserted point that is not a vertex here leaves this hull, and every one above, as it was
+    update(*node);
+    return isVertex(*node, point) ? Effect::HULL : Effect::POINTS;
+}
+
+template<typename T>
+typename DynamicConvexHull<T>::Effect DynamicConvexHull<T>::erase(std::unique_ptr<Node>& node, const Point<T>& point) {
+    if (!node) {
+        return Effect::NONE;
+    }
+    
+    if (point == node->point) {
+        if (--node->copies > 0) {
+            return Effect::POINTS;
+        }
+        node = meld(std::move(node->left), std::move(node->right));
+        return Effect::HULL;
+    }
+    
+    Effect effect = erase(isLess(point, node->point) ? node->left : node->right, point);
+    // Removing a point that was not a vertex here cannot change this hull
+    if (effect != Effect::HULL || !isVertex(*node, point)) {
+        return effect == Effect::NONE ? Effect::NONE : Effect::POINTS;
+    }
+    update(*node);
+    return Effect::HULL;
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::isVertex(const Node& node, const Point<T>& point) const {
+    return contains(node.upper, point, false) || contains(node.lower, point, true);
+}
+
+template<typename T>
+std::unique_ptr<typename DynamicConvexHull<T>::Node> DynamicConvexHull<T>::meld(std::unique_ptr<Node> left,
+                                                                                std::unique_ptr<Node> right) {
+    if (!left) return right;
+    if (!right) return left;
+    
+    if (left->priority > right->priority) {
+        left->right = meld(std::move(left->right), std::move(right));
+        update(*left);
+        return left;
+    }
+    right->left = meld(std::move(left), std::move(right->left));
+    update(*right);
+    return right;
+}
+
+template<typename T>
+void DynamicConvexHull<T>::rotateLeft(std::unique_ptr<Node>& node) {
+    std::unique_ptr<Node> pivot = std::move(node->right);
+    node->right = std::move(pivot->left);
+    update(*node);
+    pivot->left = std::move(node);
+    update(*pivot);
+    node = std::move(pivot);
+}
+
+template<typename T>
+void DynamicConvexHull<T>::rotateRight(std::unique_ptr<Node>& node) {
+    std::unique_ptr<Node> pivot = std::move(node->left);
+    node->left = std::move(pivot->right);
+    update(*node);
+    pivot->right = std::move(node);
+    update(*pivot);
+    node = std::move(pivot);
+}
+
+// Rebuilds both hulls of node from its children's in two bridge merges each
+template<typename T>
+void DynamicConvexHull<T>::update(Node& node) {
+    HullPtr upper = makeHull(node.point, node.priority, nullptr, nullptr);
+    HullPtr lower = makeHull(node.point, node.priority, nullptr, nullptr);
+    
+    if (node.left) {
+        upper = mergeUpper(node.left->upper, upper, false);
+        lower = mergeUpper(lower, node.left->lower, true);
+    }
+    if (node.right) {
+        upper = mergeUpper(upper, node.right->upper, false);
+        lower = mergeUpper(node.right->lower, lower, true);
+    }
+    
+    node.upper = std::move(upper);
+    node.lower = std::move(lower);
+}
+
+template<typename T>
+typename DynamicConvexHull<T>::HullPtr DynamicConvexHull<T>::makeHull(const Point<T>& point, uint32_t priority,
+                                                                      HullPtr left, HullPtr right) const {
+    Point<T> first = left ? left->first : point;
+    Point<T> last = right ? right->last : point;
+    return std::make_shared<HullNode>(HullNode{point, first, last, priority, std::move(left), std::move(right)});
+}
+
+template<typename T>
+typename DynamicConvexHull<T>::HullPtr DynamicConvexHull<T>::join(const HullPtr& left, const HullPtr& right) const {
+    if (!left) return right;
+    if (!right) return left;
+    
+    if (left->priority > right->priority) {
+        return makeHull(left->point, left->priority, left->left, join(left->right, right));
+    }
+    return makeHull(right->point, right->priority, join(left, right->left), right->right);
+}
+
+// Points up to and including last; untouched subtrees are shared, not copied
+template<typename T>
+typename DynamicConvexHull<T>::HullPtr DynamicConvexHull<T>::prefix(const HullPtr& hull, const Point<T>& last,
+                                                                    bool reversed) const {
+    if (!hull) return nullptr;
+    if (precedes(last, hull->point, reversed)) return prefix(hull->left, last, reversed);
+    
+    HullPtr right = prefix(hull->right, last, reversed);
+    if (right == hull->right) return hull;
+    return makeHull(hull->point, hull->priority, hull->left, right);
+}
+
+// Points from first onwards
+template<typename T>
+typename DynamicConvexHull<T>::HullPtr DynamicConvexHull<T>::suffix(const HullPtr& hull, const Point<T>& first,
+                                                                    bool reversed) const {
+    if (!hull) return nullptr;
+    if (precedes(hull->point, first, reversed)) return suffix(hull->right, first, reversed);
+    
+    HullPtr left = suffix(hull->left, first, reversed);
+    if (left == hull->left) return hull;
+    return makeHull(hull->point, hull->priority, left, hull->right);
+}
+
+// Upper hull of two upper hulls whose points are separated in the hulls' order. Both trees are
+// descended at once towards the bridge (a, b); every step discards the part of one chain that
+// cannot hold its endpoint, so the search takes O(log n)
+template<typename T>
+typename DynamicConvexHull<T>::HullPtr DynamicConvexHull<T>::mergeUpper(const HullPtr& left, const HullPtr& right,
+                                                                        bool reversed) const {
+    if (!left) return right;
+    if (!right) return left;
+    
+    const HullNode* a = left.get();
+    const HullNode* b = right.get();
+    // Neighbours that fall outside the current subtrees are the last vertices discarded
+    const Point<T>* aPrev = nullptr;
+    const Point<T>* aNext = nullptr;
+    const Point<T>* bPrev = nullptr;
+    const Point<T>* bNext = nullptr;
+    
+    while (true) {
+        const Point<T>* aMinus = a->left ? &a->left->last : aPrev;
+        const Point<T>* aPlus = a->right ? &a->right->first : aNext;
+        const Point<T>* bMinus = b->left ? &b->left->last : bPrev;
+        const Point<T>* bPlus = b->right ? &b->right->first : bNext;
+        
+        // Collinear neighbours count as above the line so the bridge ends on the outermost points
+        bool aLeft = aMinus && OrientationPredicate<T>::orientation(a->point, b->point, *aMinus) != Orientation::CLOCKWISE;
+        bool aRight = aPlus && OrientationPredicate<T>::orientation(a->point, b->point, *aPlus) == Orientation::COUNTERCLOCKWISE;
+        bool bLeft = bMinus && OrientationPredicate<T>::orientation(a->point, b->point, *bMinus) == Orientation::COUNTERCLOCKWISE;
+        bool bRight = bPlus && OrientationPredicate<T>::orientation(a->point, b->point, *bPlus) != Orientation::CLOCKWISE;
+        
+        // A neighbour above the line on the outer side settles that chain on its own; otherwise
+        // a chain that must move inwards only does so when the other one is already supported,
+        // and when both must move inwards the crossing point of their edges decides
+        bool moveALeft = aLeft;
+        bool moveBRight = bRight;
+        bool moveARight = false;
+        bool moveBLeft = false;
+        if (!aLeft && !bRight) {
+            if (aRight && bLeft) {
+                if (intersectionBefore(a->point, *aPlus, *bMinus, b->point, right->first, reversed)) {
+                    moveARight = true;
+                } else {
+                    moveBLeft = true;
+                }
+            } else {
+                moveARight = aRight;
+                moveBLeft = bLeft;
+            }
+        }
+        
+        // A move into an empty subtree can only come from rounding; that chain stays put
+        const HullNode* aTarget = moveALeft ? a->left.get() : (moveARight ? a->right.get() : nullptr);
+        const HullNode* bTarget = moveBLeft ? b->left.get() : (moveBRight ? b->right.get() : nullptr);
+        if (!aTarget && !bTarget) break;
+        
+        if (aTarget) {
+            (moveALeft ? aNext : aPrev) = &a->point;
+            a = aTarget;
+        }
+        if (bTarget) {
+            (moveBLeft ? bNext : bPrev) = &b->point;
+            b = bTarget;
+        }
+    }
+    
+    return join(prefix(left, a->point, reversed), suffix(right, b->point, reversed));
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::contains(const HullPtr& hull, const Point<T>& point, bool reversed) const {
+    const HullNode* node = hull.get();
+    while (node && !(node->point == point)) {
+        node = precedes(point, node->point, reversed) ? node->left.get() : node->right.get();
+    }
+    return node != nullptr;
+}
+
+template<typename T>
+void DynamicConvexHull<T>::collect(const HullPtr& hull, std::vector<Point<T>>& out) const {
+    if (!hull) return;
+    collect(hull->left, out);
+    out.push_back(hull->point);
+    collect(hull->right, out);
+}
+
+// Whether the lines through a, aNext and bPrev, b cross before bound in the hulls' order. The
+// crossing is a rational point, so the comparison is cross-multiplied in a wider type
+template<typename T>
+bool DynamicConvexHull<T>::intersectionBefore(const Point<T>& a, const Point<T>& aNext, const Point<T>& bPrev,
+                                              const Point<T>& b, const Point<T>& bound, bool reversed) const {
+    using Wide = std::conditional_t<std::is_integral_v<T>, __int128, long double>;
+    
+    Wide d1x = Wide(aNext.getX()) - Wide(a.getX());
+    Wide d1y = Wide(aNext.getY()) - Wide(a.getY());
+    Wide d2x = Wide(b.getX()) - Wide(bPrev.getX());
+    Wide d2y = Wide(b.getY()) - Wide(bPrev.getY());
+    Wide wx = Wide(bPrev.getX()) - Wide(a.getX());
+    Wide wy = Wide(bPrev.getY()) - Wide(a.getY());
+    
+    // crossing = a + d1 * num / den
+    Wide den = d1x * d2y - d1y * d2x;
+    Wide num = wx * d2y - wy * d2x;
+    Wide dx = (Wide(a.getX()) - Wide(bound.getX())) * den + d1x * num;
+    Wide dy = (Wide(a.getY()) - Wide(bound.getY())) * den + d1y * num;
+    if (den < 0) {
+        dx = -dx;
+        dy = -dy;
+    }
+    if (reversed) {
+        return dx > 0 || (dx == 0 && dy > 0);
+    }
+    return dx < 0 || (dx == 0 && dy < 0);
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::isLess(const Point<T>& a, const Point<T>& b) const {
+    return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+}
+
+template<typename T>
+bool DynamicConvexHull<T>::precedes(const Point<T>& a, const Point<T>& b, bool reversed) const {
+    return reversed ? isLess(b, a) : isLess(a, b);
+}
+
+// Explicit template instantiations
+template class DynamicConvexHull<int>;
+template class DynamicConvexHull<float>;
+template class DynamicConvexHull<double>;
@@ -0,0 +1,87 @@
+#ifndef DYNAMICCONVEXHULL_H
+#define DYNAMICCONVEXHULL_H
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+// Convex hull of a multiset of points under insertions and deletions, after Overmars and
+// van Leeuwen. Points live in a treap ordered lexicographically and every node keeps the upper
+// and lower hulls of its subtree as persistent treaps, joined at their bridge in O(log n), so
+// an update costs O(log^2 n) expected time and hull() costs O(h)
+template<typename T>
+class DynamicConvexHull {
+public:
+    DynamicConvexHull();
+
+    void insert(const Point<T>& point);
+    // Removes one copy of point; returns false when it is not in the set
+    bool erase(const Point<T>& point);
+
+    size_t size() const;
+    bool empty() const;
+    // CCW from the lexicographic minimum, without collinear vertices
+    Poligon<T> hull() const;
+
+private:
+    // Immutable, so hulls of a subtree are shared by every ancestor that still uses them
+    struct HullNode {
+        Point<T> point;
+        Point<T> first;
+        Point<T> last;
+        uint32_t priority;
+        std::shared_ptr<const HullNode> left;
+        std::shared_ptr<const HullNode> right;
+    };
+    using HullPtr = std::shared_ptr<const HullNode>;
+
+    struct Node {
+        Point<T> point;
+        size_t copies;
+        uint32_t priority;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+        // Upper hull of the subtree, and its lower hull ordered from the lexicographic maximum.
+        // Read that way the lower hull is an upper hull turned half a turn, which keeps every
+        // orientation, so both go through the same code with only the order reversed and no
+        // coordinate is negated (that overflows at the integer minimum)
+        HullPtr upper;
+        HullPtr lower;
+    };
+
+    // What an update did to a subtree: nothing, its point multiset only, or possibly its hulls.
+    // Ancestors only rebuild their hulls while the updated point is one of their vertices
+    enum class Effect { NONE, POINTS, HULL };
+
+    std::unique_ptr<Node> root;
+    size_t numPoints;
+    std::mt19937 random;
+
+    Effect insert(std::unique_ptr<Node>& node, const Point<T>& point);
+    Effect erase(std::unique_ptr<Node>& node, const Point<T>& point);
+    bool isVertex(const Node& node, const Point<T>& point) const;
+    std::unique_ptr<Node> meld(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+    void rotateLeft(std::unique_ptr<Node>& node);
+    void rotateRight(std::unique_ptr<Node>& node);
+    void update(Node& node);
+
+    HullPtr makeHull(const Point<T>& point, uint32_t priority, HullPtr left, HullPtr right) const;
+    HullPtr join(const HullPtr& left, const HullPtr& right) const;
+    // reversed selects the order of the lower hulls
+    HullPtr prefix(const HullPtr& hull, const Point<T>& last, bool reversed) const;
+    HullPtr suffix(const HullPtr& hull, const Point<T>& first, bool reversed) const;
+    HullPtr mergeUpper(const HullPtr& left, const HullPtr& right, bool reversed) const;
+    bool contains(const HullPtr& hull, const Point<T>& point, bool reversed) const;
+    void collect(const HullPtr& hull, std::vector<Point<T>>& out) const;
+
+    bool intersectionBefore(const Point<T>& a, const Point<T>& aNext, const Point<T>& bPrev, const Point<T>& b,
+                            const Point<T>& bound, bool reversed) const;
+    bool isLess(const Point<T>& a, const Point<T>& b) const;
+    bool precedes(const Point<T>& a, const Point<T>& b, bool reversed) const;
+};
+
+#endif
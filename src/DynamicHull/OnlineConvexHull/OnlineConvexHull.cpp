@@ -0,0 +1,130 @@
+#include "OnlineConvexHull.h"
+#include <iterator>
+#include <utility>
+
+template<typename T>
+OnlineConvexHull<T>::OnlineConvexHull()
+    : upper(LexicographicLess{false}), lower(LexicographicLess{true}), processed(0) {}
+
+template<typename T>
+bool OnlineConvexHull<T>::insert(const Point<T>& point) {
+    processed++;
+    
+    // Both lookups are O(log h); most points of a long stream stop here
+    if (isUnder(upper, point) && isUnder(lower, point)) {
+        return false;
+    }
+    
+    bool onUpper = insertInto(upper, point);
+    bool onLower = insertInto(lower, point);
+    return onUpper || onLower;
+}
+
+template<typename T>
+size_t OnlineConvexHull<T>::insert(const std::vector<Point<T>>& chunk) {
+    size_t accepted = 0;
+    for (const Point<T>& point : chunk) {
+        if (insert(point)) {
+            accepted++;
+        }
+    }
+    return accepted;
+}
+
+template<typename T>
+bool OnlineConvexHull<T>::contains(const Point<T>& point) const {
+    return isUnder(upper, point) && isUnder(lower, point);
+}
+
+template<typename T>
+size_t OnlineConvexHull<T>::numVertexes() const {
+    // Both chains hold the two lexicographic extremes
+    if (upper.size() <= 1) {
+        return upper.size();
+    }
+    return upper.size() + lower.size() - 2;
+}
+
+template<typename T>
+size_t OnlineConvexHull<T>::numProcessed() const {
+    return processed;
+}
+
+template<typename T>
+Poligon<T> OnlineConvexHull<T>::hull() const {
+    std::vector<Point<T>> vertexes;
+    vertexes.reserve(numVertexes());
+    
+    // The lower chain read backwards runs from the minimum to the maximum
+    for (auto it = lower.rbegin(); it != lower.rend(); ++it) {
+        vertexes.push_back(*it);
+    }
+    if (upper.size() > 2) {
+        for (auto it = std::next(upper.rbegin()); it != std::prev(upper.rend()); ++it) {
+            vertexes.push_back(*it);
+        }
+    }
+    
+    return Poligon<T>(std::move(vertexes), true);
+}
+
+template<typename T>
+void OnlineConvexHull<T>::clear() {
+    upper.clear();
+    lower.clear();
+    processed = 0;
+}
+
+// Adds point to an upper chain unless it lies on or under it, then drops the neighbours that
+// stop being strict right turns. Every vertex is dropped at most once, so this is amortized
+// O(log h)
+template<typename T>
+bool OnlineConvexHull<T>::insertInto(Chain& chain, const Point<T>& point) {
+    auto next = chain.lower_bound(point);
+    if (next != chain.end() && *next == point) {
+        return false;
+    }
+    if (next != chain.begin() && next != chain.end() &&
+        OrientationPredicate<T>::orientation(*std::prev(next), *next, point) != Orientation::COUNTERCLOCKWISE) {
+        return false;
+    }
+    
+    auto inserted = chain.insert(next, point);
+    
+    auto after = std::next(inserted);
+    while (after != chain.end() && std::next(after) != chain.end() &&
+           OrientationPredicate<T>::orientation(point, *after, *std::next(after)) != Orientation::CLOCKWISE) {
+        after = chain.erase(after);
+    }
+    
+    while (inserted != chain.begin() && std::prev(inserted) != chain.begin()) {
+        auto before = std::prev(inserted);
+        if (OrientationPredicate<T>::orientation(*std::prev(before), *before, point) == Orientation::CLOCKWISE) {
+            break;
+        }
+        chain.erase(before);
+    }
+    
+    return true;
+}
+
+// Whether point lies within the chain's lexicographic range and on or below it
+template<typename T>
+bool OnlineConvexHull<T>::isUnder(const Chain& chain, const Point<T>& point) const {
+    auto next = chain.lower_bound(point);
+    if (next == chain.end()) {
+        return false;
+    }
+    if (*next == point) {
+        return true;
+    }
+    if (next == chain.begin()) {
+        return false;
+    }
+    return OrientationPredicate<T>::orientation(*std::prev(next), *next, point) != Orientation::COUNTERCLOCKWISE;
+}
+
+// Explicit template instantiations
+template class OnlineConvexHull<int>;
+template class OnlineConvexHull<float>;
+template class OnlineConvexHull<double>;
@@ -0,0 +1,55 @@
+#ifndef ONLINECONVEXHULL_H
+#define ONLINECONVEXHULL_H
+
+#include <set>
+#include <vector>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+// Insertion-only hull for point streams. Only the current vertices are stored, as an upper
+// chain ordered lexicographically and a lower chain in reverse order, so memory is O(h). A point inside
+// the hull is rejected with two O(log h) lookups; an accepted one evicts the vertices it hides
+// in amortized O(log h)
+template<typename T>
+class OnlineConvexHull {
+public:
+    OnlineConvexHull();
+
+    // Returns whether point became a vertex
+    bool insert(const Point<T>& point);
+    // Returns how many points of the chunk became vertices when they arrived
+    size_t insert(const std::vector<Point<T>>& chunk);
+
+    // Whether point lies inside or on the boundary of the current hull
+    bool contains(const Point<T>& point) const;
+    size_t numVertexes() const;
+    size_t numProcessed() const;
+    // CCW from the lexicographic minimum, without collinear vertices
+    Poligon<T> hull() const;
+    void clear();
+
+private:
+    // Reversed, it orders the lower chain
+    struct LexicographicLess {
+        bool reversed;
+        bool operator()(const Point<T>& a, const Point<T>& b) const {
+            const Point<T>& first = reversed ? b : a;
+            const Point<T>& second = reversed ? a : b;
+            return first.getX() < second.getX() || (first.getX() == second.getX() && first.getY() < second.getY());
+        }
+    };
+    using Chain = std::set<Point<T>, LexicographicLess>;
+
+    // The lower chain read from the lexicographic maximum is an upper chain turned half a turn.
+    // A half turn keeps every orientation, so both chains share the same code without
+    // negating coordinates, which would overflow at the integer minimum
+    Chain upper;
+    Chain lower;
+    size_t processed;
+
+    bool insertInto(Chain& chain, const Point<T>& point);
+    bool isUnder(const Chain& chain, const Point<T>& point) const;
+};
+
+#endif
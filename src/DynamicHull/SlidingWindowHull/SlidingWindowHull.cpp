@@ -0,0 +1,49 @@
+#include "SlidingWindowHull.h"
+
+template<typename T>
+SlidingWindowHull<T>::SlidingWindowHull(size_t maxPoints, double maxAge)
+    : maxPoints(maxPoints), maxAge(maxAge) {}
+
+template<typename T>
+void SlidingWindowHull<T>::push(const Point<T>& point, double timestamp) {
+    window.emplace_back(timestamp, point);
+    dynamicHull.insert(point);
+    
+    if (maxPoints > 0) {
+        while (window.size() > maxPoints) {
+            popOldest();
+        }
+    }
+    expire(timestamp);
+}
+
+template<typename T>
+void SlidingWindowHull<T>::expire(double now) {
+    if (maxAge <= 0.0) {
+        return;
+    }
+    while (!window.empty() && window.front().first < now - maxAge) {
+        popOldest();
+    }
+}
+
+template<typename T>
+size_t SlidingWindowHull<T>::size() const {
+    return window.size();
+}
+
+template<typename T>
+Poligon<T> SlidingWindowHull<T>::hull() const {
+    return dynamicHull.hull();
+}
+
+template<typename T>
+void SlidingWindowHull<T>::popOldest() {
+    dynamicHull.erase(window.front().second);
+    window.pop_front();
+}
+
+// Explicit template instantiations
+template class SlidingWindowHull<int>;
+template class SlidingWindowHull<float>;
+template class SlidingWindowHull<double>;
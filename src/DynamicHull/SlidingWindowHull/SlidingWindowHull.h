@@ -0,0 +1,35 @@
+#ifndef SLIDINGWINDOWHULL_H
+#define SLIDINGWINDOWHULL_H
+
+#include <deque>
+#include <utility>
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "DynamicHull/DynamicConvexHull/DynamicConvexHull.h"
+
+// Hull of the most recent points of a time-stamped stream: the last maxPoints pushes and/or
+// the points no older than maxAge (a limit of 0 is disabled). Arrivals and expirations are
+// insertions and deletions on a DynamicConvexHull, O(log^2 n) each, with n the window size
+template<typename T>
+class SlidingWindowHull {
+public:
+    explicit SlidingWindowHull(size_t maxPoints, double maxAge = 0.0);
+
+    // Timestamps must not decrease
+    void push(const Point<T>& point, double timestamp = 0.0);
+    // Drops the points older than now - maxAge, for ticks with no arrivals
+    void expire(double now);
+
+    size_t size() const;
+    Poligon<T> hull() const;
+
+private:
+    size_t maxPoints;
+    double maxAge;
+    std::deque<std::pair<double, Point<T>>> window;
+    DynamicConvexHull<T> dynamicHull;
+
+    void popOldest();
+};
+
+#endif
@@ -0,0 +1,201 @@
+#include "RotatingCalipers.h"
+#include <cmath>
+#include <algorithm>
+
+template<typename T>
+typename RotatingCalipers<T>::Real RotatingCalipers<T>::Diameter::length() const {
+    return std::sqrt(Real(squaredLength));
+}
+
+template<typename T>
+const Point<T>* RotatingCalipers<T>::counterClockwise(const Poligon<T>& hull, std::vector<Point<T>>& reversed) {
+    size_t h = hull.numVertexes();
+    if (h < 3 || hull.isCCW()) {
+        return &hull[0];
+    }
+    reversed.reserve(h);
+    for (size_t i = h; i-- > 0;) {
+        reversed.push_back(hull[i]);
+    }
+    return reversed.data();
+}
+
+template<typename T>
+size_t RotatingCalipers<T>::originalVertex(size_t index, size_t h) {
+    return h - 1 - index;
+}
+
+// Edge (i, i + 1) of the copy joins original vertices h - 1 - i and h - 2 - i
+template<typename T>
+size_t RotatingCalipers<T>::originalEdge(size_t index, size_t h) {
+    return (2 * h - 2 - index) % h;
+}
+
+template<typename T>
+typename RotatingCalipers<T>::Diameter RotatingCalipers<T>::diameter(const Poligon<T>& hull) {
+    using Predicate = OrientationPredicate<T>;
+    size_t h = hull.numVertexes();
+    Diameter best{0, 0, Wide(0)};
+    if (h == 0) {
+        return best;
+    }
+
+    std::vector<Point<T>> reversed;
+    const Point<T>* p = counterClockwise(hull, reversed);
+    size_t j = 1 % h;
+    for (size_t i = 0; i < h; i++) {
+        size_t next = (i + 1) % h;
+        // The vertex farthest from the edge line is antipodal to both edge endpoints
+        while (Predicate::cross(p[i], p[next], p[(j + 1) % h]) > Predicate::cross(p[i], p[next], p[j])) {
+            j = (j + 1) % h;
+        }
+        Wide fromStart = Predicate::squaredDistance(p[i], p[j]);
+        if (fromStart > best.squaredLength) {
+            best = {std::min(i, j), std::max(i, j), fromStart};
+        }
+        Wide fromEnd = Predicate::squaredDistance(p[next], p[j]);
+        if (fromEnd > best.squaredLength) {
+            best = {std::min(next, j), std::max(next, j), fromEnd};
+        }
+    }
+    if (!reversed.empty()) {
+        best = {originalVertex(best.second, h), originalVertex(best.first, h), best.squaredLength};
+    }
+    return best;
+}
+
+template<typename T>
+typename RotatingCalipers<T>::Width RotatingCalipers<T>::width(const Poligon<T>& hull) {
+    using Predicate = OrientationPredicate<T>;
+    size_t h = hull.numVertexes();
+    Width best{0, 0, Real(0)};
+    if (h < 3) {
+        return best;
+    }
+
+    std::vector<Point<T>> reversed;
+    const Point<T>* p = counterClockwise(hull, reversed);
+    // Squared width of the best edge, cross^2 / |edge|^2
+    Real bestSquared = Real(0);
+    size_t j = 1;
+    for (size_t i = 0; i < h; i++) {
+        size_t next = (i + 1) % h;
+        while (Predicate::cross(p[i], p[next], p[(j + 1) % h]) > Predicate::cross(p[i], p[next], p[j])) {
+            j = (j + 1) % h;
+        }
+        Real height = Real(Predicate::cross(p[i], p[next], p[j]));
+        Real squared = height * height / Real(Predicate::squaredDistance(p[i], p[next]));
+        if (i == 0 || squared < bestSquared) {
+            bestSquared = squared;
+            best.edge = i;
+            best.vertex = j;
+        }
+    }
+    if (!reversed.empty()) {
+        best.edge = originalEdge(best.edge, h);
+        best.vertex = originalVertex(best.vertex, h);
+    }
+    best.width = std::sqrt(bestSquared);
+    return best;
+}
+
+template<typename T>
+typename RotatingCalipers<T>::Rectangle RotatingCalipers<T>::minimumAreaRectangle(const Poligon<T>& hull) {
+    return enclosingRectangle(hull, [](Real squaredLength, Real along, Real height) {
+        return along * height / squaredLength;
+    });
+}
+
+template<typename T>
+typename RotatingCalipers<T>::Rectangle RotatingCalipers<T>::minimumPerimeterRectangle(const Poligon<T>& hull) {
+    // Half the perimeter is (along + height) / |edge|; its square orders edges the same way
+    return enclosingRectangle(hull, [](Real squaredLength, Real along, Real height) {
+        return (along + height) * (along + height) / squaredLength;
+    });
+}
+
+template<typename T>
+template<typename Cost>
+typename RotatingCalipers<T>::Rectangle RotatingCalipers<T>::enclosingRectangle(const Poligon<T>& hull, Cost cost) {
+    using Predicate = OrientationPredicate<T>;
+    size_t h = hull.numVertexes();
+    Rectangle best{0, Real(0), Real(0), {}};
+    if (h == 0) {
+        return best;
+    }
+    std::vector<Point<T>> reversed;
+    const Point<T>* p = counterClockwise(hull, reversed);
+    if (h == 1) {
+        Point<Real> corner(Real(p[0].getX()), Real(p[0].getY()));
+        best.corners.assign(4, corner);
+        return best;
+    }
+
+    // Going CCW from an edge, the vertices reach their farthest point along the edge (right),
+    // then from its line (top), then against it (left), so each caliper starts from the previous
+    size_t right = 1, top = 1, left = 1;
+    Real bestCost = Real(0);
+    Wide bestLeft = Wide(0), bestRight = Wide(0), bestTop = Wide(0);
+    for (size_t i = 0; i < h; i++) {
+        size_t next = (i + 1) % h;
+        while (Predicate::dot(p[i], p[next], p[(right + 1) % h]) > Predicate::dot(p[i], p[next], p[right])) {
+            right = (right + 1) % h;
+        }
+        if (i == 0) {
+            top = right;
+        }
+        while (Predicate::cross(p[i], p[next], p[(top + 1) % h]) > Predicate::cross(p[i], p[next], p[top])) {
+            top = (top + 1) % h;
+        }
+        if (i == 0) {
+            left = top;
+        }
+        while (Predicate::dot(p[i], p[next], p[(left + 1) % h]) < Predicate::dot(p[i], p[next], p[left])) {
+            left = (left + 1) % h;
+        }
+
+        Wide minAlong = Predicate::dot(p[i], p[next], p[left]);
+        Wide maxAlong = Predicate::dot(p[i], p[next], p[right]);
+        Wide height = Predicate::cross(p[i], p[next], p[top]);
+        Real candidate = cost(Real(Predicate::squaredDistance(p[i], p[next])), Real(maxAlong - minAlong), Real(height));
+        if (i == 0 || candidate < bestCost) {
+            bestCost = candidate;
+            best.edge = i;
+            bestLeft = minAlong;
+            bestRight = maxAlong;
+            bestTop = height;
+        }
+    }
+
+    // Corners are the edge start moved along the edge by dot / |edge|^2 and along its left
+    // normal by cross / |edge|^2, so only the perimeter needs the edge length itself
+    const Point<T>& origin = p[best.edge];
+    const Point<T>& end = p[(best.edge + 1) % h];
+    Real ex = Real(end.getX()) - Real(origin.getX());
+    Real ey = Real(end.getY()) - Real(origin.getY());
+    Real squaredLength = ex * ex + ey * ey;
+    Real low = Real(bestLeft) / squaredLength;
+    Real high = Real(bestRight) / squaredLength;
+    Real up = Real(bestTop) / squaredLength;
+    Real ox = Real(origin.getX());
+    Real oy = Real(origin.getY());
+    best.corners = {
+        Point<Real>(ox + ex * low, oy + ey * low),
+        Point<Real>(ox + ex * high, oy + ey * high),
+        Point<Real>(ox + ex * high - ey * up, oy + ey * high + ex * up),
+        Point<Real>(ox + ex * low - ey * up, oy + ey * low + ex * up)
+    };
+    Real along = Real(bestRight - bestLeft);
+    Real height = Real(bestTop);
+    best.area = along * height / squaredLength;
+    best.perimeter = Real(2) * (along + height) / std::sqrt(squaredLength);
+    if (!reversed.empty()) {
+        best.edge = originalEdge(best.edge, h);
+    }
+    return best;
+}
+
+// Explicit template instantiations
+template class RotatingCalipers<int>;
+template class RotatingCalipers<float>;
+template class RotatingCalipers<double>;
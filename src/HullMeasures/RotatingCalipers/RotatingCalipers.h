@@ -0,0 +1,69 @@
+#ifndef ROTATINGCALIPERS_H
+#define ROTATINGCALIPERS_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+// O(h) measures of a convex polygon without collinear vertices, which is what the hull
+// strategies return. Clockwise polygons are walked in reverse and indices still refer to the
+// polygon as given. Every caliper walks the boundary once. Candidates are compared on squared
+// or unnormalized quantities, so the loops take no square roots; the only one, if any, is
+// taken on the winner. Polygons of one or two vertices give zero widths and areas
+template<typename T>
+class RotatingCalipers {
+public:
+    // Exact for integers (128 bits), T otherwise
+    using Wide = typename OrientationPredicate<T>::Wide;
+    // Widths, areas and corners of integer polygons are not integers
+    using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+    // Farthest pair of vertices
+    struct Diameter {
+        size_t first;
+        size_t second;
+        Wide squaredLength;
+        Real length() const;
+    };
+
+    // Narrowest strip holding the polygon: one side lies on edge (edge, edge + 1) and the
+    // other passes through vertex
+    struct Width {
+        size_t edge;
+        size_t vertex;
+        Real width;
+    };
+
+    // Enclosing rectangle with one side on edge (edge, edge + 1), corners CCW
+    struct Rectangle {
+        size_t edge;
+        Real area;
+        Real perimeter;
+        std::vector<Point<Real>> corners;
+    };
+
+    static Diameter diameter(const Poligon<T>& hull);
+    static Width width(const Poligon<T>& hull);
+    static Rectangle minimumAreaRectangle(const Poligon<T>& hull);
+    static Rectangle minimumPerimeterRectangle(const Poligon<T>& hull);
+
+private:
+    // The vertices in CCW order: the polygon's own, or a reversed copy left in reversed when
+    // the polygon is clockwise
+    static const Point<T>* counterClockwise(const Poligon<T>& hull, std::vector<Point<T>>& reversed);
+    // Maps a vertex or an edge start of the reversed copy back to the polygon
+    static size_t originalVertex(size_t index, size_t h);
+    static size_t originalEdge(size_t index, size_t h);
+
+    // Calipers on every edge: the farthest vertex along the edge direction, the farthest one
+    // from the edge line and the farthest one against the direction. The rectangle kept is the
+    // one minimizing cost(squaredLength, along, height), where along and height are the
+    // rectangle sides scaled by the edge length
+    template<typename Cost>
+    static Rectangle enclosingRectangle(const Poligon<T>& hull, Cost cost);
+};
+
+#endif
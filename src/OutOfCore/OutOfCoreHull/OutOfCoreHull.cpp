@@ -0,0 +1,151 @@
+#include "OutOfCoreHull.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template<typename T>
+OutOfCoreHull<T>::OutOfCoreHull(AConvexHullStrategy<T>& strategy, size_t chunkPoints)
+    : strategy(strategy), chunkPoints(std::max<size_t>(chunkPoints, 1)), pointCount(0), chunkCount(0) {}
+
+template<typename T>
+bool OutOfCoreHull<T>::apply(const std::string& path, Poligon<T>& hull) {
+    constexpr size_t recordSize = 2 * sizeof(T);
+    pointCount = 0;
+    chunkCount = 0;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size % recordSize != 0) {
+        close(fd);
+        return false;
+    }
+    size_t total = static_cast<size_t>(info.st_size) / recordSize;
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    // Windows are mapped from the page boundary at or before their first record
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<Point<T>> chunk;
+    std::vector<Point<T>> vertexes;
+
+    for (size_t begin = 0; begin < total; begin += chunkPoints) {
+        size_t end = std::min(total, begin + chunkPoints);
+        size_t firstByte = begin * recordSize;
+        size_t mapOffset = firstByte - firstByte % pageSize;
+        size_t mapLength = end * recordSize - mapOffset;
+
+        void* mapped = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        madvise(mapped, mapLength, MADV_SEQUENTIAL);
+        // Start fetching the next window while this one is being solved
+        if (end < total) {
+            size_t nextEnd = std::min(total, end + chunkPoints);
+            posix_fadvise(fd, static_cast<off_t>(end * recordSize),
+                          static_cast<off_t>((nextEnd - end) * recordSize), POSIX_FADV_WILLNEED);
+        }
+
+        // Records carry no alignment guarantee, so they are copied out byte-wise
+        chunk.clear();
+        chunk.reserve(end - begin + vertexes.size());
+        const unsigned char* records = static_cast<const unsigned char*>(mapped) + (firstByte - mapOffset);
+        for (size_t i = 0; i < end - begin; i++) {
+            T coordinates[2];
+            std::memcpy(coordinates, records + i * recordSize, recordSize);
+            chunk.emplace_back(coordinates[0], coordinates[1]);
+        }
+        munmap(mapped, mapLength);
+        // The consumed pages will not be read again; keep them from crowding the page cache
+        posix_fadvise(fd, static_cast<off_t>(mapOffset), static_cast<off_t>(mapLength), POSIX_FADV_DONTNEED);
+
+        solveChunk(chunk, vertexes);
+    }
+
+    close(fd);
+    pointCount = total;
+    hull = Poligon<T>(vertexes);
+    return true;
+}
+
+template<typename T>
+bool OutOfCoreHull<T>::apply(const PointCloudFile<T>& file, Poligon<T>& hull) {
+    pointCount = 0;
+    chunkCount = 0;
+    if (!file.isOpen()) {
+        return false;
+    }
+
+    size_t total = file.size();
+    const T* xs = file.column(0);
+    const T* ys = file.column(1);
+    std::vector<Point<T>> chunk;
+    std::vector<Point<T>> vertexes;
+
+    for (size_t begin = 0; begin < total; begin += chunkPoints) {
+        size_t end = std::min(total, begin + chunkPoints);
+        // Start fetching the next window of both columns while this one is being solved
+        if (end < total) {
+            size_t nextEnd = std::min(total, end + chunkPoints);
+            adviseColumn(xs + end, nextEnd - end, MADV_WILLNEED);
+            adviseColumn(ys + end, nextEnd - end, MADV_WILLNEED);
+        }
+
+        chunk.clear();
+        chunk.reserve(end - begin + vertexes.size());
+        for (size_t i = begin; i < end; i++) {
+            chunk.emplace_back(xs[i], ys[i]);
+        }
+        // The mapping is read-only, so dropping consumed pages only means a later read faults
+        adviseColumn(xs + begin, end - begin, MADV_DONTNEED);
+        adviseColumn(ys + begin, end - begin, MADV_DONTNEED);
+
+        solveChunk(chunk, vertexes);
+    }
+
+    pointCount = total;
+    hull = Poligon<T>(vertexes);
+    return true;
+}
+
+template<typename T>
+void OutOfCoreHull<T>::solveChunk(std::vector<Point<T>>& chunk, std::vector<Point<T>>& vertexes) {
+    chunk.insert(chunk.end(), vertexes.begin(), vertexes.end());
+    Poligon<T> chunkHull = strategy.apply(chunk);
+    vertexes.clear();
+    for (size_t i = 0; i < chunkHull.numVertexes(); i++) {
+        vertexes.push_back(chunkHull[i]);
+    }
+    chunkCount++;
+}
+
+// madvise() wants page-aligned ranges; widening to whole pages only touches the same mapping
+template<typename T>
+void OutOfCoreHull<T>::adviseColumn(const T* first, size_t count, int advice) {
+    const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = reinterpret_cast<uintptr_t>(first) / pageSize * pageSize;
+    uintptr_t end = reinterpret_cast<uintptr_t>(first + count);
+    madvise(reinterpret_cast<void*>(begin), end - begin, advice);
+}
+
+template<typename T>
+size_t OutOfCoreHull<T>::lastPointCount() const {
+    return pointCount;
+}
+
+template<typename T>
+size_t OutOfCoreHull<T>::lastChunkCount() const {
+    return chunkCount;
+}
+
+// Explicit template instantiations
+template class OutOfCoreHull<int>;
+template class OutOfCoreHull<float>;
+template class OutOfCoreHull<double>;
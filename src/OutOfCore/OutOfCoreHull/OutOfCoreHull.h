@@ -0,0 +1,44 @@
+#ifndef OUTOFCOREHULL_H
+#define OUTOFCOREHULL_H
+
+#include <string>
+#include <vector>
+#include "ConvexHullStrategy/AConvexHullStrategy.h"
+#include "Poligon/Poligon.h"
+#include "Point/Point.h"
+#include "PointCloudIO/PointCloudFile/PointCloudFile.h"
+
+// Hull of a point file larger than memory. The file is either packed (x, y) records of T in
+// native byte order or a PointCloudFile, whose columns are read in place; it is mapped one
+// window of chunkPoints records at a time, and each chunk is solved by the wrapped strategy
+// together with the vertices of the hull so far. Only one chunk and the running hull are ever
+// resident, and the kernel is told to read ahead sequentially and to drop the pages already
+// consumed
+template<typename T>
+class OutOfCoreHull {
+public:
+    explicit OutOfCoreHull(AConvexHullStrategy<T>& strategy, size_t chunkPoints = size_t(1) << 22);
+
+    // Returns false, leaving hull untouched, when the file cannot be opened or mapped or its
+    // size is not a whole number of records
+    bool apply(const std::string& path, Poligon<T>& hull);
+    // The same over the x and y columns of an open PointCloudFile (z is ignored), read in place
+    // from its mapping. Returns false, leaving hull untouched, when the file is not open
+    bool apply(const PointCloudFile<T>& file, Poligon<T>& hull);
+
+    size_t lastPointCount() const;
+    size_t lastChunkCount() const;
+
+private:
+    AConvexHullStrategy<T>& strategy;
+    size_t chunkPoints;
+    size_t pointCount;
+    size_t chunkCount;
+
+    // Replaces vertexes with the hull of chunk and vertexes
+    void solveChunk(std::vector<Point<T>>& chunk, std::vector<Point<T>>& vertexes);
+    // madvise() over the pages holding count coordinates from first
+    static void adviseColumn(const T* first, size_t count, int advice);
+};
+
+#endif
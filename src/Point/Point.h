@@ -1,27 +1,94 @@
 #ifndef POINT_H
 #define POINT_H
+#include <cstddef>
 #include <iostream>
 #include <cmath>
+#include <type_traits>
 
-template <typename T>
+// Header-only so accessors and constructors inline into the strategies' loops. The copy
+// constructor is defaulted, which keeps Point trivially copyable: vectors of points copy and
+// relocate with memcpy.
+// D is the number of stored coordinates. Planar points (the default) keep only x and y and
+// report z as 0, so a 2D cloud carries no third coordinate; 3D code uses Point3
+template <typename T, size_t D = 2>
 class Point {
+    static_assert(D == 2 || D == 3, "Points are planar or spatial");
     public:
-        Point(const T x, const T y);
-        Point(const T x, const T y, const T z);
-        Point(const Point<T> &p);
+        constexpr Point(const T x, const T y);
+        // Spatial points only
+        constexpr Point(const T x, const T y, const T z);
+        constexpr Point(const Point<T, D> &p) = default;
+        constexpr Point<T, D>& operator=(const Point<T, D> &p) = default;
 
-        T dist(const Point<T>& otro) const;
+        T dist(const Point<T, D>& otro) const;
 
-        T getX() const;
-        T getY() const;
-        T getZ() const;
+        constexpr T getX() const;
+        constexpr T getY() const;
+        constexpr T getZ() const;
 
-        bool operator==(const Point<T>& otro) const;
-        template <typename U>
-        friend std::ostream& operator<<(std::ostream& os, const Point<U>& punto);
+        constexpr bool operator==(const Point<T, D>& otro) const;
+        template <typename U, size_t E>
+        friend std::ostream& operator<<(std::ostream& os, const Point<U, E>& punto);
     private:
-        T x;
-        T y;
-        T z;
+        T coordinates[D];
 };
-#endif
\ No newline at end of file
+
+template <typename T>
+using Point3 = Point<T, 3>;
+
+// A spatial point built from x and y has z = 0
+template <typename T, size_t D>
+constexpr Point<T, D>::Point(const T x, const T y) : coordinates{x, y} {}
+
+template <typename T, size_t D>
+constexpr Point<T, D>::Point(const T x, const T y, const T z) : coordinates{x, y, z} {
+    static_assert(D == 3, "A planar point has no z");
+}
+
+template <typename T, size_t D>
+inline T Point<T, D>::dist(const Point<T, D>& otro) const {
+    T sum = T(0);
+    for (size_t axis = 0; axis < D; axis++) {
+        T delta = coordinates[axis] - otro.coordinates[axis];
+        sum += delta * delta;
+    }
+    return std::sqrt(sum);
+}
+
+template <typename T, size_t D>
+constexpr T Point<T, D>::getX() const {
+    return coordinates[0];
+}
+
+template <typename T, size_t D>
+constexpr T Point<T, D>::getY() const {
+    return coordinates[1];
+}
+
+template <typename T, size_t D>
+constexpr T Point<T, D>::getZ() const {
+    if constexpr (D == 3) {
+        return coordinates[2];
+    } else {
+        return T(0);
+    }
+}
+
+template <typename T, size_t D>
+constexpr bool Point<T, D>::operator==(const Point<T, D>& otro) const {
+    for (size_t axis = 0; axis < D; axis++) {
+        if (coordinates[axis] != otro.coordinates[axis]) return false;
+    }
+    return true;
+}
+
+// Planar points print their z of 0 too, so output does not depend on the storage
+template <typename U, size_t E>
+inline std::ostream& operator<<(std::ostream& os, const Point<U, E>& punto) {
+    os << "(" << punto.getX() << ", " << punto.getY() << ", " << punto.getZ() << ")";
+    return os;
+}
+
+static_assert(std::is_trivially_copyable_v<Point<double>>, "Point must stay trivially copyable");
+static_assert(sizeof(Point<double>) == 2 * sizeof(double), "Planar points must not carry a z");
+#endif
@@ -0,0 +1,297 @@
+#include "PointCloud.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+
+// Huge pages are 2 MB on the platforms that have them; mappings are rounded up to a whole one
+static constexpr size_t HUGE_PAGE = size_t(2) << 20;
+
+template<typename T>
+PointCloud<T>::PointCloud(size_t dimension, bool hugePages)
+    : count(0), cap(0), dims(dimension == 3 ? 3 : 2), hugePages(hugePages), hugeBacked(false),
+      stride(0), block(nullptr), blockLength(0) {}
+
+template<typename T>
+PointCloud<T>::PointCloud(const std::vector<Point<T>>& points, size_t dimension, bool hugePages)
+    : PointCloud(dimension, hugePages) {
+    assign(points);
+}
+
+template<typename T>
+PointCloud<T>::PointCloud(const std::vector<Point3<T>>& points, bool hugePages)
+    : PointCloud(3, hugePages) {
+    assign(points);
+}
+
+template<typename T>
+PointCloud<T>::~PointCloud() {
+    release(block, blockLength, hugePages);
+}
+
+template<typename T>
+PointCloud<T>::PointCloud(PointCloud&& other) noexcept
+    : count(other.count), cap(other.cap), dims(other.dims), hugePages(other.hugePages),
+      hugeBacked(other.hugeBacked), stride(other.stride), block(other.block), blockLength(other.blockLength) {
+    other.count = 0;
+    other.cap = 0;
+    other.stride = 0;
+    other.block = nullptr;
+    other.blockLength = 0;
+}
+
+template<typename T>
+PointCloud<T>& PointCloud<T>::operator=(PointCloud&& other) noexcept {
+    if (this != &other) {
+        release(block, blockLength, hugePages);
+        count = other.count;
+        cap = other.cap;
+        dims = other.dims;
+        hugePages = other.hugePages;
+        hugeBacked = other.hugeBacked;
+        stride = other.stride;
+        block = other.block;
+        blockLength = other.blockLength;
+        other.count = 0;
+        other.cap = 0;
+        other.stride = 0;
+        other.block = nullptr;
+        other.blockLength = 0;
+    }
+    return *this;
+}
+
+// Elements per column, rounded up so every column starts on a 64-byte boundary
+template<typename T>
+size_t PointCloud<T>::columnStride(size_t capacity) {
+    size_t bytes = (capacity * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    return bytes / sizeof(T);
+}
+
+template<typename T>
+T* PointCloud<T>::allocate(size_t length, bool hugePages, bool& hugeBacked) {
+    hugeBacked = false;
+    if (!hugePages) {
+        return static_cast<T*>(std::aligned_alloc(ALIGNMENT, length));
+    }
+
+    void* mapped = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    hugeBacked = mapped != MAP_FAILED;
+#endif
+    if (mapped == MAP_FAILED) {
+        mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED) {
+            return nullptr;
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(mapped, length, MADV_HUGEPAGE);
+#endif
+    }
+    return static_cast<T*>(mapped);
+}
+
+template<typename T>
+void PointCloud<T>::release(T* block, size_t length, bool mapped) {
+    if (!block) {
+        return;
+    }
+    if (mapped) {
+        munmap(block, length);
+    } else {
+        std::free(block);
+    }
+}
+
+template<typename T>
+bool PointCloud<T>::reserve(size_t capacity) {
+    if (capacity <= cap) {
+        return true;
+    }
+
+    size_t newStride = columnStride(capacity);
+    size_t length = newStride * sizeof(T) * dims;
+    if (hugePages) {
+        length = (length + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+    }
+    bool newHugeBacked;
+    T* newBlock = allocate(length, hugePages, newHugeBacked);
+    if (!newBlock) {
+        return false;
+    }
+
+    for (size_t axis = 0; axis < dims; axis++) {
+        std::copy(block + axis * stride, block + axis * stride + count, newBlock + axis * newStride);
+    }
+    release(block, blockLength, hugePages);
+    block = newBlock;
+    blockLength = length;
+    hugeBacked = newHugeBacked;
+    stride = newStride;
+    cap = newStride;
+    return true;
+}
+
+template<typename T>
+bool PointCloud<T>::resize(size_t newCount) {
+    if (!reserve(newCount)) {
+        return false;
+    }
+    for (size_t axis = 0; axis < dims && newCount > count; axis++) {
+        std::fill(block + axis * stride + count, block + axis * stride + newCount, T(0));
+    }
+    count = newCount;
+    return true;
+}
+
+template<typename T>
+bool PointCloud<T>::push_back(const Point<T>& point) {
+    return pushPoint(point);
+}
+
+template<typename T>
+bool PointCloud<T>::push_back(const Point3<T>& point) {
+    return pushPoint(point);
+}
+
+template<typename T>
+bool PointCloud<T>::assign(const std::vector<Point<T>>& points) {
+    return assignPoints(points);
+}
+
+template<typename T>
+bool PointCloud<T>::assign(const std::vector<Point3<T>>& points) {
+    return assignPoints(points);
+}
+
+template<typename T>
+template<typename P>
+bool PointCloud<T>::pushPoint(const P& point) {
+    if (count == cap && !reserve(std::max<size_t>(2 * cap, ALIGNMENT / sizeof(T)))) {
+        return false;
+    }
+    block[count] = point.getX();
+    block[stride + count] = point.getY();
+    if (dims == 3) {
+        block[2 * stride + count] = point.getZ();
+    }
+    count++;
+    return true;
+}
+
+template<typename T>
+template<typename P>
+bool PointCloud<T>::assignPoints(const std::vector<P>& points) {
+    if (!reserve(points.size())) {
+        return false;
+    }
+    T* x = xs();
+    T* y = ys();
+    T* z = zs();
+    for (size_t i = 0; i < points.size(); i++) {
+        x[i] = points[i].getX();
+        y[i] = points[i].getY();
+        if (z) {
+            z[i] = points[i].getZ();
+        }
+    }
+    count = points.size();
+    return true;
+}
+
+template<typename T>
+void PointCloud<T>::clear() {
+    count = 0;
+}
+
+template<typename T>
+size_t PointCloud<T>::size() const {
+    return count;
+}
+
+template<typename T>
+size_t PointCloud<T>::capacity() const {
+    return cap;
+}
+
+template<typename T>
+size_t PointCloud<T>::dimension() const {
+    return dims;
+}
+
+template<typename T>
+bool PointCloud<T>::empty() const {
+    return count == 0;
+}
+
+template<typename T>
+bool PointCloud<T>::hugePageBacked() const {
+    return hugeBacked;
+}
+
+template<typename T>
+T* PointCloud<T>::xs() {
+    return block;
+}
+
+template<typename T>
+T* PointCloud<T>::ys() {
+    return block ? block + stride : nullptr;
+}
+
+template<typename T>
+T* PointCloud<T>::zs() {
+    return block && dims == 3 ? block + 2 * stride : nullptr;
+}
+
+template<typename T>
+const T* PointCloud<T>::xs() const {
+    return block;
+}
+
+template<typename T>
+const T* PointCloud<T>::ys() const {
+    return block ? block + stride : nullptr;
+}
+
+template<typename T>
+const T* PointCloud<T>::zs() const {
+    return block && dims == 3 ? block + 2 * stride : nullptr;
+}
+
+template<typename T>
+Point<T> PointCloud<T>::operator[](size_t index) const {
+    return Point<T>(block[index], block[stride + index]);
+}
+
+template<typename T>
+Point3<T> PointCloud<T>::point3(size_t index) const {
+    T z = dims == 3 ? block[2 * stride + index] : T(0);
+    return Point3<T>(block[index], block[stride + index], z);
+}
+
+template<typename T>
+std::vector<Point<T>> PointCloud<T>::toPoints() const {
+    std::vector<Point<T>> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        points.push_back((*this)[i]);
+    }
+    return points;
+}
+
+template<typename T>
+typename PointCloud<T>::const_iterator PointCloud<T>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template<typename T>
+typename PointCloud<T>::const_iterator PointCloud<T>::end() const {
+    return const_iterator(this, count);
+}
+
+// Explicit template instantiations
+template class PointCloud<int>;
+template class PointCloud<float>;
+template class PointCloud<double>;
@@ -0,0 +1,105 @@
+#ifndef POINTCLOUD_H
+#define POINTCLOUD_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include "Point/Point.h"
+
+// Points stored as coordinate columns: x, y and, for dimension 3, z each live in their own
+// 64-byte aligned array, so loops over one coordinate load whole cache lines and vector
+// registers. All columns share one block; with hugePages it is mapped from 2 MB pages when the
+// system has them reserved, and otherwise marked for transparent huge pages. Growing returns
+// false instead of throwing when memory runs out, leaving the cloud unchanged
+template<typename T>
+class PointCloud {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+
+    explicit PointCloud(size_t dimension = 2, bool hugePages = false);
+    explicit PointCloud(const std::vector<Point<T>>& points, size_t dimension = 2, bool hugePages = false);
+    // Spatial points give a cloud of dimension 3
+    explicit PointCloud(const std::vector<Point3<T>>& points, bool hugePages = false);
+    ~PointCloud();
+    PointCloud(PointCloud&& other) noexcept;
+    PointCloud& operator=(PointCloud&& other) noexcept;
+    PointCloud(const PointCloud&) = delete;
+    PointCloud& operator=(const PointCloud&) = delete;
+
+    bool reserve(size_t capacity);
+    // Points added by growing are zero
+    bool resize(size_t count);
+    // Planar points leave z at 0 in dimension 3, and spatial points drop it in dimension 2
+    bool push_back(const Point<T>& point);
+    bool push_back(const Point3<T>& point);
+    bool assign(const std::vector<Point<T>>& points);
+    bool assign(const std::vector<Point3<T>>& points);
+    void clear();
+
+    size_t size() const;
+    size_t capacity() const;
+    size_t dimension() const;
+    bool empty() const;
+    // True only when the block came from reserved huge pages
+    bool hugePageBacked() const;
+
+    T* xs();
+    T* ys();
+    // nullptr in dimension 2
+    T* zs();
+    const T* xs() const;
+    const T* ys() const;
+    const T* zs() const;
+
+    Point<T> operator[](size_t index) const;
+    // z is 0 in dimension 2
+    Point3<T> point3(size_t index) const;
+    std::vector<Point<T>> toPoints() const;
+
+    // Walks the cloud building each Point on the fly; there is no Point to reference
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Point<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Point<T>;
+
+        const_iterator(const PointCloud<T>* cloud, size_t index) : cloud(cloud), index(index) {}
+
+        Point<T> operator*() const { return (*cloud)[index]; }
+        const_iterator& operator++() { ++index; return *this; }
+        const_iterator operator++(int) { const_iterator previous = *this; ++index; return previous; }
+        bool operator==(const const_iterator& other) const { return index == other.index && cloud == other.cloud; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        const PointCloud<T>* cloud;
+        size_t index;
+    };
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    size_t count;
+    size_t cap;
+    size_t dims;
+    bool hugePages;
+    bool hugeBacked;
+    // Distance in elements between the starts of two columns
+    size_t stride;
+    T* block;
+    size_t blockLength;
+
+    template<typename P>
+    bool pushPoint(const P& point);
+    template<typename P>
+    bool assignPoints(const std::vector<P>& points);
+
+    static size_t columnStride(size_t capacity);
+    static T* allocate(size_t length, bool hugePages, bool& hugeBacked);
+    static void release(T* block, size_t length, bool mapped);
+};
+
+#endif
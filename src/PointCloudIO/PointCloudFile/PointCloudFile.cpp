@@ -0,0 +1,207 @@
+#include "PointCloudFile.h"
+#include <cstring>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template<typename T>
+PointCloudFile<T>::PointCloudFile() : mapping(nullptr), mappingLength(0), header() {}
+
+template<typename T>
+PointCloudFile<T>::~PointCloudFile() {
+    close();
+}
+
+template<typename T>
+bool PointCloudFile<T>::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+    size_t length = static_cast<size_t>(info.st_size);
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+
+    Header candidate;
+    std::memcpy(&candidate, mapped, sizeof(Header));
+    bool valid = std::memcmp(candidate.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                 candidate.version == VERSION &&
+                 candidate.scalarType == scalarType() &&
+                 (candidate.dimension == 2 || candidate.dimension == 3) &&
+                 (candidate.kind == PointSetKind::CLOUD || candidate.kind == PointSetKind::HULL) &&
+                 // Bounded first so a corrupt count cannot overflow the stride
+                 candidate.count <= length / sizeof(T) &&
+                 candidate.columnStride == columnStride(candidate.count) &&
+                 (length - sizeof(Header)) / candidate.dimension >= candidate.columnStride;
+    if (!valid) {
+        munmap(mapped, length);
+        return false;
+    }
+
+    mapping = static_cast<const unsigned char*>(mapped);
+    mappingLength = length;
+    header = candidate;
+    return true;
+}
+
+template<typename T>
+void PointCloudFile<T>::close() {
+    if (mapping) {
+        munmap(const_cast<unsigned char*>(mapping), mappingLength);
+    }
+    mapping = nullptr;
+    mappingLength = 0;
+    header = Header();
+}
+
+template<typename T>
+bool PointCloudFile<T>::isOpen() const {
+    return mapping != nullptr;
+}
+
+template<typename T>
+size_t PointCloudFile<T>::size() const {
+    return static_cast<size_t>(header.count);
+}
+
+template<typename T>
+size_t PointCloudFile<T>::dimension() const {
+    return header.dimension;
+}
+
+template<typename T>
+PointSetKind PointCloudFile<T>::kind() const {
+    return header.kind;
+}
+
+template<typename T>
+const T* PointCloudFile<T>::column(size_t axis) const {
+    return reinterpret_cast<const T*>(mapping + sizeof(Header) + axis * header.columnStride);
+}
+
+template<typename T>
+Point<T> PointCloudFile<T>::point(size_t index) const {
+    return Point<T>(column(0)[index], column(1)[index]);
+}
+
+template<typename T>
+Point3<T> PointCloudFile<T>::point3(size_t index) const {
+    T z = header.dimension == 3 ? column(2)[index] : T(0);
+    return Point3<T>(column(0)[index], column(1)[index], z);
+}
+
+template<typename T>
+std::vector<Point<T>> PointCloudFile<T>::points() const {
+    std::vector<Point<T>> result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        result.push_back(point(i));
+    }
+    return result;
+}
+
+template<typename T>
+bool PointCloudFile<T>::write(const std::string& path, const std::vector<Point<T>>& points,
+                              size_t dimension, PointSetKind kind) {
+    return writePoints(path, points, dimension, kind);
+}
+
+template<typename T>
+bool PointCloudFile<T>::write(const std::string& path, const std::vector<Point3<T>>& points, PointSetKind kind) {
+    return writePoints(path, points, 3, kind);
+}
+
+template<typename T>
+template<typename P>
+bool PointCloudFile<T>::writePoints(const std::string& path, const std::vector<P>& points,
+                                    size_t dimension, PointSetKind kind) {
+    if (dimension != 2 && dimension != 3) {
+        return false;
+    }
+
+    Header fresh = Header();
+    std::memcpy(fresh.magic, MAGIC, sizeof(MAGIC));
+    fresh.version = VERSION;
+    fresh.scalarType = scalarType();
+    fresh.dimension = static_cast<uint8_t>(dimension);
+    fresh.kind = kind;
+    fresh.count = points.size();
+    fresh.columnStride = columnStride(points.size());
+    size_t length = sizeof(Header) + dimension * fresh.columnStride;
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(length)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+
+    // ftruncate zero-fills, so the block padding needs no writes
+    unsigned char* bytes = static_cast<unsigned char*>(mapped);
+    std::memcpy(bytes, &fresh, sizeof(Header));
+    T* xs = reinterpret_cast<T*>(bytes + sizeof(Header));
+    T* ys = reinterpret_cast<T*>(bytes + sizeof(Header) + fresh.columnStride);
+    T* zs = reinterpret_cast<T*>(bytes + sizeof(Header) + 2 * fresh.columnStride);
+    for (size_t i = 0; i < points.size(); i++) {
+        xs[i] = points[i].getX();
+        ys[i] = points[i].getY();
+        if (dimension == 3) {
+            zs[i] = points[i].getZ();
+        }
+    }
+
+    bool flushed = msync(mapped, length, MS_SYNC) == 0;
+    munmap(mapped, length);
+    return flushed;
+}
+
+template<typename T>
+bool PointCloudFile<T>::write(const std::string& path, const Poligon<T>& hull) {
+    std::vector<Point<T>> vertexes;
+    vertexes.reserve(hull.numVertexes());
+    for (size_t i = 0; i < hull.numVertexes(); i++) {
+        vertexes.push_back(hull[i]);
+    }
+    return write(path, vertexes, 2, PointSetKind::HULL);
+}
+
+template<typename T>
+ScalarType PointCloudFile<T>::scalarType() {
+    if constexpr (std::is_same_v<T, int>) {
+        static_assert(sizeof(int) == 4, "INT32 files store 32-bit integers");
+        return ScalarType::INT32;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return ScalarType::FLOAT32;
+    } else {
+        return ScalarType::FLOAT64;
+    }
+}
+
+template<typename T>
+uint64_t PointCloudFile<T>::columnStride(uint64_t count) {
+    return (count * sizeof(T) + 63) / 64 * 64;
+}
+
+// Explicit template instantiations
+template class PointCloudFile<int>;
+template class PointCloudFile<float>;
+template class PointCloudFile<double>;
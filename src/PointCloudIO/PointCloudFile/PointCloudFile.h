@@ -0,0 +1,88 @@
+#ifndef POINTCLOUDFILE_H
+#define POINTCLOUDFILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+
+enum class ScalarType : uint8_t {
+    INT32 = 1,
+    FLOAT32 = 2,
+    FLOAT64 = 3
+};
+
+enum class PointSetKind : uint8_t {
+    CLOUD = 0,
+    // Vertices in hull order
+    HULL = 1
+};
+
+// Binary point sets, native (little-endian) byte order. A 64-byte header is followed by one
+// block per axis (x, y and, for dimension 3, z) of count coordinates of T; every block is
+// padded to a multiple of 64 bytes so columns stay cache-line aligned. Files are read through
+// a read-only mapping, so columns are exposed in place without parsing
+template<typename T>
+class PointCloudFile {
+public:
+    static constexpr uint16_t VERSION = 1;
+
+    PointCloudFile();
+    ~PointCloudFile();
+    PointCloudFile(const PointCloudFile&) = delete;
+    PointCloudFile& operator=(const PointCloudFile&) = delete;
+
+    // Returns false, leaving the reader closed, when the file is missing, is not this format or
+    // version, stores another scalar type or an unknown kind, or is shorter than its header says
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+
+    size_t size() const;
+    size_t dimension() const;
+    PointSetKind kind() const;
+    // size() coordinates along axis (0 = x, 1 = y, 2 = z), straight from the mapping
+    const T* column(size_t axis) const;
+    Point<T> point(size_t index) const;
+    // z is 0 in a file of dimension 2
+    Point3<T> point3(size_t index) const;
+    std::vector<Point<T>> points() const;
+
+    // Writes through a shared mapping of the new file; dimension 3 also stores z, which is 0
+    // for planar points
+    static bool write(const std::string& path, const std::vector<Point<T>>& points,
+                      size_t dimension = 2, PointSetKind kind = PointSetKind::CLOUD);
+    static bool write(const std::string& path, const std::vector<Point3<T>>& points,
+                      PointSetKind kind = PointSetKind::CLOUD);
+    static bool write(const std::string& path, const Poligon<T>& hull);
+
+private:
+    struct Header {
+        char magic[8];
+        uint16_t version;
+        ScalarType scalarType;
+        uint8_t dimension;
+        PointSetKind kind;
+        uint8_t reserved[3];
+        uint64_t count;
+        // Bytes from the start of one column block to the next
+        uint64_t columnStride;
+        uint8_t padding[32];
+    };
+    static_assert(sizeof(Header) == 64, "the on-disk header is 64 bytes");
+
+    static constexpr char MAGIC[8] = {'G', 'E', 'O', 'C', 'L', 'O', 'U', 'D'};
+
+    const unsigned char* mapping;
+    size_t mappingLength;
+    Header header;
+
+    static ScalarType scalarType();
+    static uint64_t columnStride(uint64_t count);
+    template<typename P>
+    static bool writePoints(const std::string& path, const std::vector<P>& points,
+                            size_t dimension, PointSetKind kind);
+};
+
+#endif
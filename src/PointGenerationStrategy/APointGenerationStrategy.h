@@ -2,6 +2,7 @@
 #define APOINTGENERATIONSTRATEGY_H
 #include <vector>
 #include "Point/Point.h"
+#include "PointCloud/PointCloud.h"
 
 template<typename T>
 class APointGenerationStrategy {
@@ -9,5 +10,10 @@ public:
     virtual ~APointGenerationStrategy() = default;
 
     virtual std::vector<Point<T>> generate(size_t n_points, double param = 0.0) = 0;
+
+    // Same distribution as generate(), written into cloud; false if it cannot hold n_points
+    virtual bool generateInto(PointCloud<T>& cloud, size_t n_points, double param = 0.0) {
+        return cloud.assign(generate(n_points, param));
+    }
 };
 #endif
\ No newline at end of file
@@ -20,6 +20,26 @@ class RandomPointGenerator : public APointGenerationStrategy<T> {
 
             return cloud;
         }
+
+        // Coordinates go straight into the columns, with no Point in between
+        bool generateInto(PointCloud<T>& cloud, size_t n_points, double = 0.0) override {
+            if (!cloud.resize(n_points)) {
+                return false;
+            }
+
+            std::random_device rd;
+            std::mt19937 gen(rd());
+            std::uniform_real_distribution<> distrib(0.0, 10000.0);
+
+            T* xs = cloud.xs();
+            T* ys = cloud.ys();
+            for (size_t i = 0; i < n_points; ++i) {
+                xs[i] = distrib(gen);
+                ys[i] = distrib(gen);
+            }
+
+            return true;
+        }
 };
 
 template class RandomPointGenerator<double>;
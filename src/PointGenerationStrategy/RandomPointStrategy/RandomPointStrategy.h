@@ -7,6 +7,7 @@ template<typename T>
 class RandomPointGenerator : public APointGenerationStrategy<T> {
 public:
     std::vector<Point<T>> generate(size_t n_points, double param = 0.0) override;
+    bool generateInto(PointCloud<T>& cloud, size_t n_points, double param = 0.0) override;
 };
 
 #endif
@@ -0,0 +1,245 @@
+#include "ConvexPolygonLocator.h"
+#include <algorithm>
+#include <cmath>
+
+template<typename T>
+ConvexPolygonLocator<T>::ConvexPolygonLocator(const Poligon<T>& polygon, size_t numThreads, size_t grainSize)
+    : lanesExact(true),
+      grainSize(std::max<size_t>(grainSize, LANES)),
+      pool(std::make_unique<WorkStealingPool>(numThreads)) {
+    std::vector<Point<T>> vertexes;
+    for (size_t i = 0; i < polygon.numVertexes(); i++) {
+        vertexes.push_back(polygon[i]);
+    }
+    size_t n = vertexes.size();
+
+    auto turn = [&](size_t i) {
+        const Point<T>& a = vertexes[(i + n - 1) % n];
+        const Point<T>& b = vertexes[i];
+        const Point<T>& c = vertexes[(i + 1) % n];
+        return OrientationPredicate<T>::sign(a.getX(), a.getY(), b.getX(), b.getY(), c.getX(), c.getY());
+    };
+    int orientation = 0;
+    for (size_t i = 0; i < n && orientation == 0; i++) {
+        orientation = turn(i);
+    }
+
+    if (orientation == 0) {
+        // No area: a segment between the extremes, a single point, or nothing
+        auto lexicographic = [](const Point<T>& a, const Point<T>& b) {
+            return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+        };
+        if (n > 0) {
+            auto extremes = std::minmax_element(vertexes.begin(), vertexes.end(), lexicographic);
+            Point<T> first = *extremes.first;
+            Point<T> last = *extremes.second;
+            vertexes.assign(1, first);
+            if (!(first == last)) {
+                vertexes.push_back(last);
+            }
+        }
+    } else {
+        if (orientation < 0) {
+            std::reverse(vertexes.begin(), vertexes.end());
+        }
+        // Duplicates and vertices in the middle of an edge would make the wedges ambiguous
+        for (size_t i = 0; vertexes.size() > 3 && i < vertexes.size();) {
+            n = vertexes.size();
+            if (turn(i) == 0) {
+                vertexes.erase(vertexes.begin() + i);
+                i = i > 0 ? i - 1 : 0;
+            } else {
+                i++;
+            }
+        }
+    }
+
+    for (const Point<T>& vertex : vertexes) {
+        xs.push_back(vertex.getX());
+        ys.push_back(vertex.getY());
+        Lane dx = Lane(vertex.getX()) - Lane(vertexes[0].getX());
+        Lane dy = Lane(vertex.getY()) - Lane(vertexes[0].getY());
+        dxs.push_back(dx);
+        dys.push_back(dy);
+        if constexpr (std::is_integral_v<T>) {
+            lanesExact = lanesExact && std::abs(dx) < LANE_LIMIT && std::abs(dy) < LANE_LIMIT;
+        }
+    }
+}
+
+template<typename T>
+PointLocation ConvexPolygonLocator<T>::locate(const Point<T>& point) const {
+    return exactLocate(point.getX(), point.getY());
+}
+
+template<typename T>
+bool ConvexPolygonLocator<T>::contains(const Point<T>& point) const {
+    return locate(point) != PointLocation::OUTSIDE;
+}
+
+template<typename T>
+void ConvexPolygonLocator<T>::locate(const T* pointXs, const T* pointYs, size_t count, PointLocation* locations,
+                                     size_t stride) const {
+    locateBatch([pointXs, stride](size_t i) { return pointXs[i * stride]; },
+                [pointYs, stride](size_t i) { return pointYs[i * stride]; }, count, locations);
+}
+
+template<typename T>
+void ConvexPolygonLocator<T>::locate(const Point<T>* points, size_t count, std::vector<PointLocation>& locations) const {
+    locations.resize(count);
+    locateBatch([points](size_t i) { return points[i].getX(); },
+                [points](size_t i) { return points[i].getY(); }, count, locations.data());
+}
+
+template<typename T>
+void ConvexPolygonLocator<T>::locate(const PointCloud<T>& cloud, std::vector<PointLocation>& locations) const {
+    locations.resize(cloud.size());
+    locate(cloud.xs(), cloud.ys(), cloud.size(), locations.data());
+}
+
+template<typename T>
+template<typename X, typename Y>
+void ConvexPolygonLocator<T>::locateBatch(X x, Y y, size_t count, PointLocation* locations) const {
+    if (pool->numThreads() == 1 || count <= grainSize) {
+        locateRange(x, y, 0, count, locations);
+        return;
+    }
+    pool->parallelFor(0, count, grainSize, [&](size_t begin, size_t end) {
+        locateRange(x, y, begin, end, locations);
+    });
+}
+
+// The wedge search on one query with the exact predicate. Wedge i lies between the rays from
+// the first vertex through vertexes i and i + 1
+template<typename T>
+PointLocation ConvexPolygonLocator<T>::exactLocate(T x, T y) const {
+    size_t h = xs.size();
+    if (h == 0) return PointLocation::OUTSIDE;
+    if (h == 1) return (x == xs[0] && y == ys[0]) ? PointLocation::BOUNDARY : PointLocation::OUTSIDE;
+
+    auto sign = [&](size_t a, size_t b) {
+        return OrientationPredicate<T>::sign(xs[a], ys[a], xs[b], ys[b], x, y);
+    };
+    if (h == 2) {
+        bool between = std::min(xs[0], xs[1]) <= x && x <= std::max(xs[0], xs[1]) &&
+                       std::min(ys[0], ys[1]) <= y && y <= std::max(ys[0], ys[1]);
+        return (sign(0, 1) == 0 && between) ? PointLocation::BOUNDARY : PointLocation::OUTSIDE;
+    }
+
+    int first = sign(0, 1);
+    if (first < 0) return PointLocation::OUTSIDE;
+    int last = sign(0, h - 1);
+    if (last > 0) return PointLocation::OUTSIDE;
+
+    size_t base = 1;
+    for (size_t n = h - 2; n > 1;) {
+        size_t half = n / 2;
+        if (sign(0, base + half) >= 0) base += half;
+        n -= half;
+    }
+
+    int far = sign(base, base + 1);
+    if (far < 0) return PointLocation::OUTSIDE;
+    // On the far edge, or on one of the two edges that leave the first vertex
+    if (far == 0 || (first == 0 && base == 1) || (last == 0 && base == h - 2)) return PointLocation::BOUNDARY;
+    return PointLocation::INSIDE;
+}
+
+// Lockstep version of exactLocate(): every lane takes the same number of search steps, so the
+// lane loops compile to selects (and gathers on AVX2) instead of branches
+template<typename T>
+template<typename X, typename Y>
+void ConvexPolygonLocator<T>::locateRange(X x, Y y, size_t begin, size_t end, PointLocation* locations) const {
+    size_t h = xs.size();
+    if (h < 3 || !lanesExact) {
+        for (size_t i = begin; i < end; i++) {
+            locations[i] = exactLocate(x(i), y(i));
+        }
+        return;
+    }
+
+    const T* vx = xs.data();
+    const T* vy = ys.data();
+    const Lane* dx = dxs.data();
+    const Lane* dy = dys.data();
+    const Lane x0 = vx[0];
+    const Lane y0 = vy[0];
+
+    // Floating turns inside Shewchuk's bound, zeros included, make the lane doubtful
+    auto cross = [](Lane ax, Lane ay, Lane bx, Lane by, bool& doubt) {
+        Lane left = ax * by;
+        Lane right = ay * bx;
+        Lane turn = left - right;
+        if constexpr (std::is_floating_point_v<T>) {
+            doubt |= std::abs(turn) <= OrientationPredicate<T>::ERROR_BOUND * (std::abs(left) + std::abs(right));
+        }
+        return turn;
+    };
+
+    for (size_t i = begin; i < end; i += LANES) {
+        size_t active = std::min(LANES, end - i);
+
+        Lane px[LANES];
+        Lane py[LANES];
+        Lane qx[LANES];
+        Lane qy[LANES];
+        size_t base[LANES];
+        bool doubt[LANES];
+        // A short final batch repeats its last query in the spare lanes
+        for (size_t lane = 0; lane < LANES; lane++) {
+            size_t k = i + std::min(lane, active - 1);
+            px[lane] = x(k);
+            py[lane] = y(k);
+            qx[lane] = px[lane] - x0;
+            qy[lane] = py[lane] - y0;
+            doubt[lane] = false;
+            if constexpr (std::is_integral_v<T>) {
+                // Far queries would overflow 64 bits; park them on the first vertex
+                doubt[lane] = (std::abs(qx[lane]) >= LANE_LIMIT) | (std::abs(qy[lane]) >= LANE_LIMIT);
+                qx[lane] = doubt[lane] ? 0 : qx[lane];
+                qy[lane] = doubt[lane] ? 0 : qy[lane];
+                px[lane] = doubt[lane] ? x0 : px[lane];
+                py[lane] = doubt[lane] ? y0 : py[lane];
+            }
+            base[lane] = 1;
+        }
+
+        Lane first[LANES];
+        Lane last[LANES];
+        for (size_t lane = 0; lane < LANES; lane++) {
+            first[lane] = cross(dx[1], dy[1], qx[lane], qy[lane], doubt[lane]);
+            last[lane] = cross(dx[h - 1], dy[h - 1], qx[lane], qy[lane], doubt[lane]);
+        }
+
+        for (size_t n = h - 2; n > 1;) {
+            size_t half = n / 2;
+            for (size_t lane = 0; lane < LANES; lane++) {
+                size_t mid = base[lane] + half;
+                Lane turn = cross(dx[mid], dy[mid], qx[lane], qy[lane], doubt[lane]);
+                base[lane] = turn >= 0 ? mid : base[lane];
+            }
+            n -= half;
+        }
+
+        for (size_t lane = 0; lane < active; lane++) {
+            size_t b = base[lane];
+            Lane far = cross(Lane(vx[b + 1]) - Lane(vx[b]), Lane(vy[b + 1]) - Lane(vy[b]),
+                             px[lane] - Lane(vx[b]), py[lane] - Lane(vy[b]), doubt[lane]);
+            bool outside = (first[lane] < 0) | (last[lane] > 0) | (far < 0);
+            bool boundary = (far == 0) | ((first[lane] == 0) & (b == 1)) | ((last[lane] == 0) & (b == h - 2));
+            locations[i + lane] = outside ? PointLocation::OUTSIDE
+                                          : (boundary ? PointLocation::BOUNDARY : PointLocation::INSIDE);
+        }
+
+        for (size_t lane = 0; lane < active; lane++) {
+            if (doubt[lane]) {
+                locations[i + lane] = exactLocate(x(i + lane), y(i + lane));
+            }
+        }
+    }
+}
+
+// Explicit template instantiations
+template class ConvexPolygonLocator<int>;
+template class ConvexPolygonLocator<float>;
+template class ConvexPolygonLocator<double>;
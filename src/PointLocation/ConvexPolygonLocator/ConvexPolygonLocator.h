@@ -0,0 +1,61 @@
+#ifndef CONVEXPOLYGONLOCATOR_H
+#define CONVEXPOLYGONLOCATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "PointCloud/PointCloud.h"
+#include "PointLocation/PointLocation.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include "ThreadPool/WorkStealingPool.h"
+
+// Containment queries against one convex polygon in O(log h). Seen from the first vertex, the
+// other vertices split the plane into wedges sorted by angle; a binary search finds the wedge
+// of the query and one orientation test against its far edge decides the rest. Every answer
+// is exact. Batches run LANES queries through the search in lockstep with no branches; a float
+// query whose turns fall inside the rounding bound, or an integer query too far away for 64
+// bits, is redone with the exact predicate. Batches larger than grainSize are split across
+// numThreads threads
+template<typename T>
+class ConvexPolygonLocator {
+public:
+    // polygon must be convex, in either orientation; hull strategy output always is
+    explicit ConvexPolygonLocator(const Poligon<T>& polygon, size_t numThreads = 1, size_t grainSize = 65536);
+
+    PointLocation locate(const Point<T>& point) const;
+    // Inside or on the boundary
+    bool contains(const Point<T>& point) const;
+
+    // Point i is (xs[i * stride], ys[i * stride]), as in MonotoneChainAlgorithm's zero-copy apply
+    void locate(const T* xs, const T* ys, size_t count, PointLocation* locations, size_t stride = 1) const;
+    void locate(const Point<T>* points, size_t count, std::vector<PointLocation>& locations) const;
+    void locate(const PointCloud<T>& cloud, std::vector<PointLocation>& locations) const;
+
+private:
+    // One 256-bit (AVX2) register worth of coordinates per batch, as in the gift wrapping scan
+    static constexpr size_t LANES = 32 / sizeof(T);
+    // Floats stay in T behind an error filter, integers widen to 64 bits
+    using Lane = std::conditional_t<std::is_floating_point_v<T>, T, int64_t>;
+    // Integer lanes are exact while every coordinate difference stays below this
+    static constexpr int64_t LANE_LIMIT = int64_t(1) << 30;
+
+    // CCW vertices, and the same vertices relative to the first one
+    std::vector<T> xs;
+    std::vector<T> ys;
+    std::vector<Lane> dxs;
+    std::vector<Lane> dys;
+    bool lanesExact;
+    size_t grainSize;
+    std::unique_ptr<WorkStealingPool> pool;
+
+    PointLocation exactLocate(T x, T y) const;
+    template<typename X, typename Y>
+    void locateBatch(X x, Y y, size_t count, PointLocation* locations) const;
+    template<typename X, typename Y>
+    void locateRange(X x, Y y, size_t begin, size_t end, PointLocation* locations) const;
+};
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef POINTLOCATION_H
+#define POINTLOCATION_H
+
+#include <cstdint>
+
+enum class PointLocation : uint8_t {
+    OUTSIDE = 0,
+    BOUNDARY = 1,
+    INSIDE = 2
+};
+
+#endif
@@ -1,10 +1,23 @@
 #include "Poligon.h"
-#include "Vector/Vector.h"
 #include <algorithm>
 #include <cmath>
+#include <utility>
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
 
 template <typename T>
-Poligon<T>::Poligon(const std::vector<Point<T>>& vertexes) : vertexes(vertexes) {}
+Poligon<T>::Poligon(const std::vector<Point<T>>& vertexes)
+    : vertexes(vertexes), convexCCW(false), cached(0), twiceArea(0), convex(false), box(), length(0),
+      center(Real(0), Real(0)) {}
+
+template <typename T>
+Poligon<T>::Poligon(std::vector<Point<T>>&& vertexes)
+    : vertexes(std::move(vertexes)), convexCCW(false), cached(0), twiceArea(0), convex(false), box(), length(0),
+      center(Real(0), Real(0)) {}
+
+template <typename T>
+Poligon<T>::Poligon(std::vector<Point<T>>&& vertexes, bool convexCCW) : Poligon(std::move(vertexes)) {
+    this->convexCCW = convexCCW;
+}
 
 template <typename T>
 size_t Poligon<T>::numVertexes() const {
@@ -12,40 +25,150 @@ size_t Poligon<T>::numVertexes() const {
 }
 
 template <typename T>
-T Poligon<T>::shoelace() const {
-    if (vertexes.size() < 3) return T(0);
-    
-    T sum = T(0);
-    for (size_t i = 0; i < vertexes.size(); ++i) {
+typename Poligon<T>::Wide Poligon<T>::shoelace() const {
+    if (cached & SHOELACE) return twiceArea;
+
+    Wide sum = Wide(0);
+    for (size_t i = 0; vertexes.size() >= 3 && i < vertexes.size(); ++i) {
         size_t next = (i + 1) % vertexes.size();
         
-        // Create vectors from current vertex to previous and next
-        Vector<T> v1(vertexes[i]); 
-        Vector<T> v2(vertexes[next]);
-        
-        // Use cross product from Vector class and extract z coordinate
-        Vector<T> crossResult = v1.cross(v2);
-        sum += crossResult.getZ();
+        // z coordinate of the cross product of the two position vectors
+        sum += Wide(vertexes[i].getX()) * vertexes[next].getY() - Wide(vertexes[i].getY()) * vertexes[next].getX();
     }
 
+    twiceArea = sum;
+    cached |= SHOELACE;
     return sum;
-
 }
 
 template <typename T>
 bool Poligon<T>::isCCW() const {
-    return shoelace() > T(0);
+    // A hull without collinear vertices encloses area once it has three of them
+    if (convexCCW) return vertexes.size() >= 3;
+    return shoelace() > Wide(0);
+}
+
+// Every turn bends the same way and the edges sweep through the x directions only once, which
+// rules out polygons that wind around more than once
+template <typename T>
+bool Poligon<T>::isConvex() const {
+    if (convexCCW || vertexes.size() < 3) return true;
+    if (cached & CONVEXITY) return convex;
+
+    size_t n = vertexes.size();
+    int turnSign = 0;
+    int previousDirection = 0;
+    int firstDirection = 0;
+    int directionChanges = 0;
+    convex = true;
+    for (size_t i = 0; i < n && convex; ++i) {
+        const Point<T>& a = vertexes[i];
+        const Point<T>& b = vertexes[(i + 1) % n];
+        const Point<T>& c = vertexes[(i + 2) % n];
+        int turn = OrientationPredicate<T>::sign(a.getX(), a.getY(), b.getX(), b.getY(), c.getX(), c.getY());
+        if (turn != 0) {
+            convex = turnSign == 0 || turn == turnSign;
+            turnSign = turn;
+        }
+
+        int direction = (b.getX() > a.getX()) - (b.getX() < a.getX());
+        if (direction != 0) {
+            if (firstDirection == 0) firstDirection = direction;
+            if (previousDirection != 0 && direction != previousDirection) directionChanges++;
+            previousDirection = direction;
+        }
+    }
+    if (previousDirection != 0 && previousDirection != firstDirection) directionChanges++;
+    convex = convex && directionChanges <= 2;
+
+    cached |= CONVEXITY;
+    return convex;
 }
 
 template <typename T>
 T Poligon<T>::area() const {
-    return std::abs(shoelace()) / T(2);
+    Wide sum = shoelace();
+    return static_cast<T>((sum < 0 ? -sum : sum) / Wide(2));
+}
+
+template <typename T>
+T Poligon<T>::signedArea() const {
+    return static_cast<T>(shoelace() / Wide(2));
+}
+
+template <typename T>
+const typename Poligon<T>::Bounds& Poligon<T>::bounds() const {
+    if (cached & BOUNDS) return box;
+
+    box = Bounds();
+    if (!vertexes.empty()) {
+        box = {vertexes[0].getX(), vertexes[0].getY(), vertexes[0].getX(), vertexes[0].getY()};
+    }
+    for (const Point<T>& vertex : vertexes) {
+        box.minX = std::min(box.minX, vertex.getX());
+        box.minY = std::min(box.minY, vertex.getY());
+        box.maxX = std::max(box.maxX, vertex.getX());
+        box.maxY = std::max(box.maxY, vertex.getY());
+    }
+
+    cached |= BOUNDS;
+    return box;
+}
+
+template <typename T>
+typename Poligon<T>::Real Poligon<T>::perimeter() const {
+    if (cached & PERIMETER) return length;
+
+    length = Real(0);
+    for (size_t i = 0; vertexes.size() >= 2 && i < vertexes.size(); ++i) {
+        const Point<T>& a = vertexes[i];
+        const Point<T>& b = vertexes[(i + 1) % vertexes.size()];
+        Real dx = Real(b.getX()) - Real(a.getX());
+        Real dy = Real(b.getY()) - Real(a.getY());
+        length += std::sqrt(dx * dx + dy * dy);
+    }
+
+    cached |= PERIMETER;
+    return length;
+}
+
+template <typename T>
+const Point<typename Poligon<T>::Real>& Poligon<T>::centroid() const {
+    if (cached & CENTROID) return center;
+
+    size_t n = vertexes.size();
+    Real sumX = Real(0);
+    Real sumY = Real(0);
+    Wide twice = shoelace();
+    if (twice != Wide(0)) {
+        // Each edge contributes the triangle it spans with the origin
+        for (size_t i = 0; i < n; ++i) {
+            const Point<T>& a = vertexes[i];
+            const Point<T>& b = vertexes[(i + 1) % n];
+            Real cross = Real(a.getX()) * Real(b.getY()) - Real(a.getY()) * Real(b.getX());
+            sumX += (Real(a.getX()) + Real(b.getX())) * cross;
+            sumY += (Real(a.getY()) + Real(b.getY())) * cross;
+        }
+        Real scale = Real(3) * Real(twice);
+        center = Point<Real>(sumX / scale, sumY / scale);
+    } else {
+        for (const Point<T>& vertex : vertexes) {
+            sumX += Real(vertex.getX());
+            sumY += Real(vertex.getY());
+        }
+        center = n ? Point<Real>(sumX / Real(n), sumY / Real(n)) : Point<Real>(Real(0), Real(0));
+    }
+
+    cached |= CENTROID;
+    return center;
 }
 
 template <typename T>
 void Poligon<T>::fromCWToCCW() {
     if (!isCCW()) {
         std::reverse(vertexes.begin(), vertexes.end());
+        // isCCW() left the signed area cached; reversing flips it and keeps everything else
+        twiceArea = -twiceArea;
     }
 }
 
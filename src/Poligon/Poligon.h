@@ -1,25 +1,72 @@
 #ifndef POLIGON_H
 #define POLIGON_H
 #include <iostream>
+#include <type_traits>
 #include <vector>
 #include "Point/Point.h"
 #include "Vector/Vector.h"
+
+// Derived properties (signed area, orientation, convexity, bounding box, perimeter and
+// centroid) are computed on first use and cached; fromCWToCCW() is the only mutation and keeps
+// them up to date. Filling the cache writes to the object, so const queries are not thread
+// safe: query every property once before sharing a Poligon between threads
 template <typename T>
 class Poligon {
     public:
+        // Perimeters and centroids of integer polygons are not integers
+        using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+        struct Bounds {
+            T minX;
+            T minY;
+            T maxX;
+            T maxY;
+        };
+
         Poligon(const std::vector<Point<T>>& vertexes);
+        Poligon(std::vector<Point<T>>&& vertexes);
+        // With convexCCW the caller guarantees what hull strategies return: a convex polygon
+        // in CCW order without collinear vertices. Orientation and convexity then need no pass
+        Poligon(std::vector<Point<T>>&& vertexes, bool convexCCW);
 
         size_t numVertexes() const;
         bool isCCW() const;
+        bool isConvex() const;
         T area() const;
+        // Positive when CCW
+        T signedArea() const;
+        // All zero for a polygon without vertices
+        const Bounds& bounds() const;
+        Real perimeter() const;
+        // Center of mass of the enclosed area; the mean vertex when the area is zero
+        const Point<Real>& centroid() const;
         void fromCWToCCW();
 
         const Point<T>& operator[](size_t index) const;
         template <typename U>
         friend std::ostream& operator<<(std::ostream& os, const Poligon<U>& p);
     private:
+        // Twice the signed area; integer coordinates accumulate in 128 bits so it cannot overflow
+        using Wide = std::conditional_t<std::is_integral_v<T>, __int128, T>;
+
+        enum Cached : unsigned {
+            SHOELACE = 1,
+            CONVEXITY = 2,
+            BOUNDS = 4,
+            PERIMETER = 8,
+            CENTROID = 16
+        };
+
         std::vector<Point<T>> vertexes;
-        T shoelace() const;
+        bool convexCCW;
+        mutable unsigned cached;
+        mutable Wide twiceArea;
+        mutable bool convex;
+        mutable Bounds box;
+        mutable Real length;
+        mutable Point<Real> center;
+
+        Wide shoelace() const;
 
 };
-#endif
\ No newline at end of file
+#endif
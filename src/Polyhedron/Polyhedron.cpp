@@ -0,0 +1,87 @@
+#include "Polyhedron.h"
+#include <algorithm>
+#include <utility>
+
+template <typename T>
+Polyhedron<T>::Polyhedron(const std::vector<Point3<T>>& vertexes, const std::vector<std::array<size_t, 3>>& faces)
+    : vertexes(vertexes), faces(faces) {}
+
+template <typename T>
+size_t Polyhedron<T>::numVertexes() const {
+    return vertexes.size();
+}
+
+template <typename T>
+size_t Polyhedron<T>::numFaces() const {
+    return faces.size();
+}
+
+// Divergence theorem: every outward face adds the signed volume of the tetrahedron it
+// spans with the origin. Integer triple products reach 3 x 31 bits, so they are taken in Wide
+template <typename T>
+typename Polyhedron<T>::Real Polyhedron<T>::volume() const {
+    Wide sum = Wide(0);
+    for (const std::array<size_t, 3>& f : faces) {
+        const Point3<T>& a = vertexes[f[0]];
+        const Point3<T>& b = vertexes[f[1]];
+        const Point3<T>& c = vertexes[f[2]];
+        // a . (b x c)
+        sum += Wide(a.getX()) * (Wide(b.getY()) * c.getZ() - Wide(b.getZ()) * c.getY())
+             - Wide(a.getY()) * (Wide(b.getX()) * c.getZ() - Wide(b.getZ()) * c.getX())
+             + Wide(a.getZ()) * (Wide(b.getX()) * c.getY() - Wide(b.getY()) * c.getX());
+    }
+    return Real(sum) / Real(6);
+}
+
+template <typename T>
+bool Polyhedron<T>::isClosed() const {
+    if (faces.empty()) return false;
+
+    std::vector<std::pair<size_t, size_t>> edges;
+    edges.reserve(3 * faces.size());
+    for (const std::array<size_t, 3>& f : faces) {
+        for (size_t k = 0; k < 3; ++k) {
+            edges.emplace_back(f[k], f[(k + 1) % 3]);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    for (size_t i = 0; i < edges.size(); ++i) {
+        if (i > 0 && edges[i] == edges[i - 1]) return false;
+        std::pair<size_t, size_t> twin(edges[i].second, edges[i].first);
+        if (!std::binary_search(edges.begin(), edges.end(), twin)) return false;
+    }
+    return true;
+}
+
+template <typename T>
+const Point3<T>& Polyhedron<T>::vertex(size_t index) const {
+    return vertexes[index];
+}
+
+template <typename T>
+const std::array<size_t, 3>& Polyhedron<T>::face(size_t index) const {
+    return faces[index];
+}
+
+template <typename U>
+std::ostream& operator<<(std::ostream& os, const Polyhedron<U>& p) {
+    os << "[";
+    for (size_t i = 0; i < p.faces.size(); ++i) {
+        const std::array<size_t, 3>& f = p.faces[i];
+        os << "(" << p.vertexes[f[0]] << ", " << p.vertexes[f[1]] << ", " << p.vertexes[f[2]] << ")";
+        if (i + 1 < p.faces.size()) {
+            os << ", ";
+        }
+    }
+    os << "]";
+    return os;
+}
+
+// Explicit template instantiations
+template class Polyhedron<int>;
+template class Polyhedron<float>;
+template class Polyhedron<double>;
+template std::ostream& operator<<(std::ostream&, const Polyhedron<int>&);
+template std::ostream& operator<<(std::ostream&, const Polyhedron<float>&);
+template std::ostream& operator<<(std::ostream&, const Polyhedron<double>&);
@@ -0,0 +1,34 @@
+#ifndef POLYHEDRON_H
+#define POLYHEDRON_H
+#include <array>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "Point/Point.h"
+#include "Vector/Vector.h"
+template <typename T>
+class Polyhedron {
+    public:
+        // Each face holds three indices into vertexes, CCW when seen from outside
+        Polyhedron(const std::vector<Point3<T>>& vertexes, const std::vector<std::array<size_t, 3>>& faces);
+
+        size_t numVertexes() const;
+        size_t numFaces() const;
+        // Integer volumes are summed exactly in 128 bits and need not be whole
+        using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+        Real volume() const;
+        // Every edge is shared by exactly two faces that traverse it in opposite directions
+        bool isClosed() const;
+
+        const Point3<T>& vertex(size_t index) const;
+        const std::array<size_t, 3>& face(size_t index) const;
+        template <typename U>
+        friend std::ostream& operator<<(std::ostream& os, const Polyhedron<U>& p);
+    private:
+        using Wide = std::conditional_t<std::is_integral_v<T>, __int128, T>;
+
+        std::vector<Point3<T>> vertexes;
+        std::vector<std::array<size_t, 3>> faces;
+
+};
+#endif
@@ -0,0 +1,86 @@
+#include "WorkStealingPool.h"
+
+thread_local WorkStealingPool* WorkStealingPool::currentPool = nullptr;
+thread_local size_t WorkStealingPool::currentQueue = 0;
+
+WorkStealingPool::WorkStealingPool(size_t numThreads) {
+    if (numThreads == 0) numThreads = 1;
+
+    // Queue 0 is shared by external callers, queue i belongs to worker i
+    for (size_t i = 0; i < numThreads; ++i) {
+        queues.push_back(std::make_unique<TaskQueue>());
+    }
+    for (size_t i = 1; i < numThreads; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t WorkStealingPool::numThreads() const {
+    return queues.size();
+}
+
+void WorkStealingPool::submit(std::function<void()> task) {
+    size_t index = (currentPool == this) ? currentQueue : 0;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    pending.fetch_add(1, std::memory_order_release);
+
+    // Taking the sleep mutex orders this wake-up after a worker's predicate check
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    sleepCondition.notify_one();
+}
+
+bool WorkStealingPool::runPendingTask() {
+    size_t self = (currentPool == this) ? currentQueue : 0;
+    std::function<void()> task;
+
+    for (size_t k = 0; k < queues.size() && !task; ++k) {
+        TaskQueue& queue = *queues[(self + k) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        // Own work newest first (cache-warm), stolen work oldest first (largest)
+        if (k == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+
+    pending.fetch_sub(1, std::memory_order_acq_rel);
+    task();
+    return true;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentQueue = index;
+
+    while (true) {
+        if (runPendingTask()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() {
+            return stopping || pending.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping) return;
+    }
+}
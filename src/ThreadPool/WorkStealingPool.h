@@ -0,0 +1,91 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fork-join pool: every worker owns a deque, pushes and pops its own tasks LIFO and
+// steals FIFO from the others. Threads waiting on a fork keep running pending tasks.
+class WorkStealingPool {
+public:
+    // numThreads counts the calling thread, so a pool of 1 runs everything inline
+    explicit WorkStealingPool(size_t numThreads = std::thread::hardware_concurrency());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t numThreads() const;
+
+    // Runs both callables, the first one possibly on another thread, and returns when both finished
+    template<typename F, typename G>
+    void invoke(F&& first, G&& second);
+
+    // Calls body(chunkBegin, chunkEnd) over [begin, end) split into chunks of at most grainSize
+    template<typename F>
+    void parallelFor(size_t begin, size_t end, size_t grainSize, F&& body);
+
+private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> pending{0};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    bool stopping = false;
+
+    static thread_local WorkStealingPool* currentPool;
+    static thread_local size_t currentQueue;
+
+    void submit(std::function<void()> task);
+    bool runPendingTask();
+    void workerLoop(size_t index);
+};
+
+template<typename F, typename G>
+void WorkStealingPool::invoke(F&& first, G&& second) {
+    if (workers.empty()) {
+        first();
+        second();
+        return;
+    }
+
+    std::atomic<bool> done{false};
+    submit([&first, &done]() {
+        first();
+        done.store(true, std::memory_order_release);
+    });
+
+    second();
+
+    while (!done.load(std::memory_order_acquire)) {
+        if (!runPendingTask()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<typename F>
+void WorkStealingPool::parallelFor(size_t begin, size_t end, size_t grainSize, F&& body) {
+    if (grainSize == 0) grainSize = 1;
+    if (end - begin <= grainSize || workers.empty()) {
+        if (begin < end) body(begin, end);
+        return;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    invoke([&]() { parallelFor(begin, mid, grainSize, body); },
+           [&]() { parallelFor(mid, end, grainSize, body); });
+}
+
+#endif
@@ -2,28 +2,114 @@
 #define VECTOR_H
 
 #include <iostream>
+#include <cmath>
+#include <type_traits>
 #include "Point/Point.h"
+
+// Header-only and trivially copyable for the same reasons as Point. Vectors always keep three
+// components, since the cross product of planar vectors points along z
 template <typename T>
 class Vector {
     public:
-        Vector(const T x, const T y);
-        Vector(const T x, const T y, const T z);
-        Vector(const Point<T> end);
-        Vector(const Vector<T> &v);
+        constexpr Vector(const T x, const T y);
+        constexpr Vector(const T x, const T y, const T z);
+        constexpr Vector(const Point<T> end);
+        constexpr Vector(const Point3<T> end);
+        constexpr Vector(const Vector<T> &v) = default;
+        constexpr Vector<T>& operator=(const Vector<T> &v) = default;
 
-        Vector<T> cross(const Vector<T>& other) const;
-        T dot(const Vector<T>& other) const;
+        constexpr Vector<T> cross(const Vector<T>& other) const;
+        constexpr T dot(const Vector<T>& other) const;
         T length() const;
-        T getZ() const;
+        constexpr T getX() const;
+        constexpr T getY() const;
+        constexpr T getZ() const;
 
-        Vector<T> operator+(const Vector<T>& other) const;
-        Vector<T> operator-(const Vector<T>& other) const;
-        Vector<T> operator*(const T scalar) const;
-        bool operator==(const Vector<T>& other) const;
+        constexpr Vector<T> operator+(const Vector<T>& other) const;
+        constexpr Vector<T> operator-(const Vector<T>& other) const;
+        constexpr Vector<T> operator*(const T scalar) const;
+        constexpr bool operator==(const Vector<T>& other) const;
         template <typename U>
         friend std::ostream& operator<<(std::ostream& os, const Vector<U>& vector);
 
     private:
-        Point<T> end;
+        Point3<T> end;
 };
-#endif
\ No newline at end of file
+
+template <typename T>
+constexpr Vector<T>::Vector(const T x, const T y, const T z) : end(x, y, z) {}
+
+template <typename T>
+constexpr Vector<T>::Vector(const T x, const T y) : Vector(x, y, 0) {}
+
+template <typename T>
+constexpr Vector<T>::Vector(const Point<T> end) : end(end.getX(), end.getY(), T(0)) {}
+
+template <typename T>
+constexpr Vector<T>::Vector(const Point3<T> end) : end(end) {}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::cross(const Vector<T>& other) const {
+    // Planar vectors have z = 0, so only the z component survives for them
+    return Vector<T>(end.getY() * other.end.getZ() - end.getZ() * other.end.getY(),
+                     end.getZ() * other.end.getX() - end.getX() * other.end.getZ(),
+                     end.getX() * other.end.getY() - end.getY() * other.end.getX());
+}
+
+template <typename T>
+constexpr T Vector<T>::getX() const {
+    return end.getX();
+}
+
+template <typename T>
+constexpr T Vector<T>::getY() const {
+    return end.getY();
+}
+
+template <typename T>
+constexpr T Vector<T>::getZ() const {
+    return end.getZ();
+}
+
+template <typename T>
+constexpr T Vector<T>::dot(const Vector<T>& other) const {
+    return end.getX() * other.end.getX() + end.getY() * other.end.getY() + end.getZ() * other.end.getZ();
+}
+
+template <typename T>
+inline T Vector<T>::length() const {
+    return std::sqrt(dot(*this));
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::operator+(const Vector<T>& other) const {
+    return Vector<T>(end.getX() + other.end.getX(), end.getY() + other.end.getY(), end.getZ() + other.end.getZ());
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::operator-(const Vector<T>& other) const {
+    return Vector<T>(end.getX() - other.end.getX(), end.getY() - other.end.getY(), end.getZ() - other.end.getZ());
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::operator*(const T scalar) const {
+    return Vector<T>(end.getX() * scalar, end.getY() * scalar, end.getZ() * scalar);
+}
+
+template <typename T>
+constexpr bool Vector<T>::operator==(const Vector<T>& other) const {
+    return end == other.end;
+}
+
+template <typename U>
+inline std::ostream& operator<<(std::ostream& os, const Vector<U>& vector) {
+    os << "Vector(" << vector.end.getX() << ", " << vector.end.getY();
+    if (vector.end.getZ() != 0) {
+        os << ", " << vector.end.getZ();
+    }
+    os << ")";
+    return os;
+}
+
+static_assert(std::is_trivially_copyable_v<Vector<double>>, "Vector must stay trivially copyable");
+#endif
@@ -7,13 +7,21 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <thread>
+#include <filesystem>
 
 #include "Point/Point.h"
 #include "Poligon/Poligon.h"
 #include "ConvexHullStrategy/GiftWrappingAlgorithm/GiftWrappingAlgorithm.h"
 #include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "ConvexHullStrategy/ChanAlgorithm/ChanAlgorithm.h"
+#include "ConvexHullStrategy/QuickHullAlgorithm/QuickHullAlgorithm.h"
+#include "ConvexHullStrategy/AklToussaintFilter/AklToussaintFilter.h"
+#include "ConvexHullStrategy/ApproximateHullAlgorithm/ApproximateHullAlgorithm.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
 #include "PointGenerationStrategy/RandomPointStrategy/RandomPointStrategy.h"
 #include "PointGenerationStrategy/HullPercentageStrategy/HullPercentageStrategy.h"
+#include "PointCloudIO/PointCloudFile/PointCloudFile.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -60,6 +68,26 @@ bool arePolygonsEqual(const Poligon<T>& p1, const Poligon<T>& p2) {
     return counterclockwise_match;
 }
 
+// Clouds are generated once and then reused from benchmark_data/, so repeated runs time the
+// strategies on identical inputs. Delete the directory to draw fresh ones
+template<typename T, typename Generate>
+vector<Point<T>> loadOrGenerate(const string& name, Generate generate) {
+    const string directory = "benchmark_data";
+    const string path = directory + "/" + name + ".gcl";
+    
+    PointCloudFile<T> cached;
+    if (cached.open(path)) {
+        return cached.points();
+    }
+    
+    vector<Point<T>> points = generate();
+    filesystem::create_directories(directory);
+    if (!PointCloudFile<T>::write(path, points)) {
+        cout << "Warning: could not cache " << path << "\n";
+    }
+    return points;
+}
+
 void generateGraphs() {
     cout << "Generating visualization graphs...\n";
     
@@ -80,6 +108,8 @@ try:
     # Time comparison
     ax1.loglog(df['Points'], df['GiftWrap_Time_ms'], 'r-o', label='Gift Wrapping', linewidth=2)
     ax1.loglog(df['Points'], df['DivideConquer_Time_ms'], 'b-s', label='Divide & Conquer', linewidth=2)
+    ax1.loglog(df['Points'], df['Chan_Time_ms'], 'g-^', label='Chan', linewidth=2)
+    ax1.loglog(df['Points'], df['QuickHull_Time_ms'], 'm-d', label='Parallel QuickHull', linewidth=2)
     ax1.set_xlabel('Number of Points')
     ax1.set_ylabel('Time (ms)')
     ax1.set_title('Algorithm Performance Scalability')
@@ -136,6 +166,8 @@ try:
                       color=colors[i % len(colors)], marker='o', label=f'GiftWrap {pct}%')
             ax1.loglog(subset['Points'], subset['DivideConquer_Time_ms'], 
                       color=colors[i % len(colors)], marker='s', label=f'D&C {pct}%', linestyle='--')
+            ax1.loglog(subset['Points'], subset['Chan_Time_ms'], 
+                      color=colors[i % len(colors)], marker='^', label=f'Chan {pct}%', linestyle=':')
     ax1.set_xlabel('Number of Points')
     ax1.set_ylabel('Time (ms)')
     ax1.set_title('Worst Case Performance Analysis')
@@ -209,12 +241,19 @@ int main() {
     
     // Test parameters - Updated for scalability analysis
     vector<size_t> point_counts = {100, 1000, 10000, 100000, 1000000}; // 10^2 to 10^6
-    vector<size_t> worst_case_point_counts = {100, 1000, 5000, 10000}; // Reduced for worst case
+    vector<size_t> worst_case_point_counts = {100, 1000, 10000, 100000}; // Up to 10^5 with the threaded Gift Wrapping scan
     vector<double> hull_percentages = {50.0, 90.0, 100.0}; // Worst case intensities
     
     // Create algorithms
-    GiftWrappingAlgorithm<T> giftWrap;
+    size_t numThreads = max(1u, thread::hardware_concurrency());
+    GiftWrappingAlgorithm<T> giftWrap(numThreads);
     DivideAndConquerAlgorithm<T> divideConquer;
+    ChanAlgorithm<T> chan;
+    QuickHullAlgorithm<T> quickHull(numThreads);
+    DivideAndConquerAlgorithm<T> parallelDivideConquer(numThreads);
+    AklToussaintFilter<T> filteredDivideConquer(divideConquer);
+    const double approximationEpsilon = 1.0; // Clouds span [0, 10000]^2
+    ApproximateHullAlgorithm<T> approximateHull(approximationEpsilon);
     
     // Create point generators
     RandomPointGenerator<T> randomGen;
@@ -227,8 +266,8 @@ int main() {
     ofstream summaryFile("benchmark_summary.txt");
     
     // CSV headers
-    csvScalability << "Points,GiftWrap_Time_ms,DivideConquer_Time_ms,GiftWrap_Hull_Size,DivideConquer_Hull_Size,Results_Match\n";
-    csvWorstCase << "Points,Hull_Percentage,GiftWrap_Time_ms,DivideConquer_Time_ms,Hull_Size,Expected_Hull_Points,Results_Match\n";
+    csvScalability << "Points,GiftWrap_Time_ms,DivideConquer_Time_ms,GiftWrap_Hull_Size,DivideConquer_Hull_Size,Results_Match,Chan_Time_ms,Chan_Hull_Size,Chan_Match,QuickHull_Time_ms,QuickHull_Threads,QuickHull_Match,Filtered_DC_Time_ms,Filter_Dropped_Points,Parallel_DC_Time_ms,Parallel_DC_Threads,Parallel_DC_Speedup,Parallel_DC_Match,Approx_Time_ms,Approx_Hull_Size,Approx_Error,Approx_Speedup\n";
+    csvWorstCase << "Points,Hull_Percentage,GiftWrap_Time_ms,DivideConquer_Time_ms,Hull_Size,Expected_Hull_Points,Results_Match,Chan_Time_ms,Chan_Match,Filtered_DC_Time_ms,Filter_Dropped_Points,Exact_Fallbacks\n";
     csvComparison << "Strategy,Parameter,Points,GiftWrap_Time_ms,DivideConquer_Time_ms,Speed_Ratio,Results_Match\n";
     
     // Summary header
@@ -236,12 +275,13 @@ int main() {
     summaryFile << "===========================================\n\n";
     summaryFile << "Point counts tested: 10^2, 10^3, 10^4, 10^5, 10^6\n";
     summaryFile << "Hull percentages (worst case): 50%, 90%, 100%\n";
-    summaryFile << "Worst case point counts: 100, 1K, 5K, 10K (reduced to avoid timeouts)\n\n";
+    summaryFile << "Worst case point counts: 100, 1K, 10K, 100K\n\n";
     
     int total_tests = 0;
     int matching_results = 0;
     double total_gift_time = 0.0;
     double total_dc_time = 0.0;
+    double total_chan_time = 0.0;
     
     cout << "Starting scalability analysis...\n\n";
     
@@ -254,7 +294,7 @@ int main() {
         cout << "Testing scalability with " << n << " points...\n";
         
         // Generate points
-        vector<Point<T>> points = randomGen.generate(n);
+        vector<Point<T>> points = loadOrGenerate<T>("random_" + to_string(n), [&]() { return randomGen.generate(n); });
         
         // Measure Gift Wrapping time
         auto start = high_resolution_clock::now();
@@ -268,15 +308,62 @@ int main() {
         end = high_resolution_clock::now();
         double dcTime = duration_cast<microseconds>(end - start).count() / 1000.0;
 
+        // Measure Chan time
+        start = high_resolution_clock::now();
+        Poligon<T> chanResult = chan.apply(points);
+        end = high_resolution_clock::now();
+        double chanTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+
+        // Measure parallel QuickHull time
+        start = high_resolution_clock::now();
+        Poligon<T> quickHullResult = quickHull.apply(points);
+        end = high_resolution_clock::now();
+        double quickHullTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+
+        // Measure Divide and Conquer behind the Akl-Toussaint filter
+        start = high_resolution_clock::now();
+        filteredDivideConquer.apply(points);
+        end = high_resolution_clock::now();
+        double filteredTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+        size_t droppedPoints = filteredDivideConquer.lastDroppedCount();
+
+        // Measure fork-join Divide and Conquer time
+        start = high_resolution_clock::now();
+        Poligon<T> parallelDcResult = parallelDivideConquer.apply(points);
+        end = high_resolution_clock::now();
+        double parallelDcTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+
+        // Measure the epsilon-approximate hull; its error is the distance of the farthest
+        // point of the cloud (hence of the D&C hull) outside it
+        start = high_resolution_clock::now();
+        Poligon<T> approximateResult = approximateHull.apply(points);
+        end = high_resolution_clock::now();
+        double approximateTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+        double approximateError = approximateHull.lastError();
+        double approximateSpeedup = (approximateTime > 0) ? dcTime / approximateTime : 0.0;
+
         // Verify results match
         bool resultsMatch = arePolygonsEqual(giftResult, dcResult);
+        bool chanMatch = arePolygonsEqual(chanResult, dcResult);
+        bool quickHullMatch = arePolygonsEqual(quickHullResult, dcResult);
+        bool parallelDcMatch = arePolygonsEqual(parallelDcResult, dcResult);
         double speedRatio = (dcTime > 0) ? giftTime / dcTime : 0.0;
+        double threadSpeedup = (parallelDcTime > 0) ? dcTime / parallelDcTime : 0.0;
 
         // Output to scalability CSV
         csvScalability << n << "," << fixed << setprecision(3) 
                       << giftTime << "," << dcTime << "," 
                       << giftResult.numVertexes() << "," << dcResult.numVertexes() << ","
-                      << (resultsMatch ? "Yes" : "No") << "\n";
+                      << (resultsMatch ? "Yes" : "No") << ","
+                      << chanTime << "," << chanResult.numVertexes() << ","
+                      << (chanMatch ? "Yes" : "No") << ","
+                      << quickHullTime << "," << numThreads << ","
+                      << (quickHullMatch ? "Yes" : "No") << ","
+                      << filteredTime << "," << droppedPoints << ","
+                      << parallelDcTime << "," << numThreads << "," << threadSpeedup << ","
+                      << (parallelDcMatch ? "Yes" : "No") << ","
+                      << approximateTime << "," << approximateResult.numVertexes() << ","
+                      << approximateError << "," << approximateSpeedup << "\n";
         
         // Output to comparison CSV
         csvComparison << "Random,N/A," << n << "," << fixed << setprecision(3) 
@@ -285,18 +372,29 @@ int main() {
         
         // Output to summary
         summaryFile << "  " << n << " points: GiftWrap=" << giftTime << "ms, "
-                    << "DivideConquer=" << dcTime << "ms, Hull=" << giftResult.numVertexes() 
+                    << "DivideConquer=" << dcTime << "ms, Chan=" << chanTime 
+                    << "ms, QuickHull(" << numThreads << " threads)=" << quickHullTime
+                    << "ms, Parallel D&C(" << numThreads << " threads)=" << parallelDcTime
+                    << "ms, Filtered D&C=" << filteredTime << "ms (dropped " << droppedPoints << ")"
+                    << ", Approx(eps=" << approximationEpsilon << ")=" << approximateTime << "ms ("
+                    << approximateResult.numVertexes() << " vertices, error=" << approximateError
+                    << ", " << approximateSpeedup << "x vs D&C)"
+                    << ", Hull=" << giftResult.numVertexes() 
                     << " vertices, Speed ratio=" << speedRatio << "x, Match=" 
-                    << (resultsMatch ? "Yes" : "No") << "\n";
+                    << (resultsMatch ? "Yes" : "No") << ", Chan match=" 
+                    << (chanMatch ? "Yes" : "No") << "\n";
         
         // Update statistics
         total_tests++;
         if (resultsMatch) matching_results++;
         total_gift_time += giftTime;
         total_dc_time += dcTime;
+        total_chan_time += chanTime;
         
         cout << "  GiftWrap: " << giftTime << "ms, DivideConquer: " << dcTime 
-             << "ms, Hull: " << giftResult.numVertexes() << " vertices, Speed ratio: " 
+             << "ms, Chan: " << chanTime << "ms, QuickHull: " << quickHullTime 
+             << "ms, Approx: " << approximateTime << "ms (error " << approximateError << ")"
+             << ", Hull: " << giftResult.numVertexes() << " vertices, Speed ratio: " 
              << speedRatio << "x, Match: " << (resultsMatch ? "Yes" : "No") << "\n";
     }
     
@@ -312,17 +410,15 @@ int main() {
         for (size_t n : worst_case_point_counts) {
             cout << "  " << n << " points...\n";
             
-            // Skip very large tests for high hull percentages to avoid hanging
-            if ((percentage >= 90.0 && n > 5000) || (percentage == 100.0 && n > 1000)) {
-                cout << "    Skipping " << n << " points with " << percentage << "% hull (too slow)\n";
-                continue;
-            }
-            
             // Generate points
             cout << "    Generating points...\n";
-            vector<Point<T>> points = hullGen.generate(n, percentage);
+            vector<Point<T>> points = loadOrGenerate<T>("hull_" + to_string(static_cast<int>(percentage)) + "_" + to_string(n),
+                                                        [&]() { return hullGen.generate(n, percentage); });
             
-            // Measure Gift Wrapping time with timeout check
+            // Orientation tests that needed exact arithmetic, over all four runs
+            OrientationPredicate<T>::resetSlowPathCount();
+            
+            // Measure Gift Wrapping time
             cout << "    Running Gift Wrapping...\n";
             auto start = high_resolution_clock::now();
             Poligon<T> giftResult = giftWrap.apply(points);
@@ -336,15 +432,34 @@ int main() {
             end = high_resolution_clock::now();
             double dcTime = duration_cast<microseconds>(end - start).count() / 1000.0;
             
+            // Measure Chan time
+            cout << "    Running Chan...\n";
+            start = high_resolution_clock::now();
+            Poligon<T> chanResult = chan.apply(points);
+            end = high_resolution_clock::now();
+            double chanTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+            
+            // Measure Divide and Conquer behind the Akl-Toussaint filter
+            cout << "    Running filtered Divide & Conquer...\n";
+            start = high_resolution_clock::now();
+            filteredDivideConquer.apply(points);
+            end = high_resolution_clock::now();
+            double filteredTime = duration_cast<microseconds>(end - start).count() / 1000.0;
+            size_t droppedPoints = filteredDivideConquer.lastDroppedCount();
+            size_t exactFallbacks = OrientationPredicate<T>::slowPathCount();
+            
             // Verify results match
             bool resultsMatch = arePolygonsEqual(giftResult, dcResult);
+            bool chanMatch = arePolygonsEqual(chanResult, dcResult);
             double speedRatio = (dcTime > 0) ? giftTime / dcTime : 0.0;
             size_t expectedHullPoints = static_cast<size_t>(n * (percentage / 100.0));
             
             // Output to worst case CSV
             csvWorstCase << n << "," << percentage << "," << fixed << setprecision(3) 
                         << giftTime << "," << dcTime << "," << giftResult.numVertexes() 
-                        << "," << expectedHullPoints << "," << (resultsMatch ? "Yes" : "No") << "\n";
+                        << "," << expectedHullPoints << "," << (resultsMatch ? "Yes" : "No") 
+                        << "," << chanTime << "," << (chanMatch ? "Yes" : "No") 
+                        << "," << filteredTime << "," << droppedPoints << "," << exactFallbacks << "\n";
             
             // Output to comparison CSV
             csvComparison << "HullPercentage," << percentage << "," << n << "," 
@@ -353,18 +468,21 @@ int main() {
             
             // Output to summary
             summaryFile << "    " << n << " points: GiftWrap=" << giftTime << "ms, "
-                        << "DivideConquer=" << dcTime << "ms, Hull=" << giftResult.numVertexes()
+                        << "DivideConquer=" << dcTime << "ms, Chan=" << chanTime 
+                        << "ms, Hull=" << giftResult.numVertexes()
                         << "/" << expectedHullPoints << " vertices, Speed ratio=" << speedRatio 
-                        << "x, Match=" << (resultsMatch ? "Yes" : "No") << "\n";
+                        << "x, Match=" << (resultsMatch ? "Yes" : "No")
+                        << ", Exact fallbacks=" << exactFallbacks << "\n";
             
             // Update statistics
             total_tests++;
             if (resultsMatch) matching_results++;
             total_gift_time += giftTime;
             total_dc_time += dcTime;
+            total_chan_time += chanTime;
             
             cout << "    GiftWrap: " << giftTime << "ms, DivideConquer: " << dcTime 
-                 << "ms, Hull: " << giftResult.numVertexes() << "/" << expectedHullPoints
+                 << "ms, Chan: " << chanTime << "ms, Hull: " << giftResult.numVertexes() << "/" << expectedHullPoints
                  << " vertices, Speed ratio: " << speedRatio << "x, Match: " 
                  << (resultsMatch ? "Yes" : "No") << "\n";
         }
@@ -381,6 +499,7 @@ int main() {
     summaryFile << "PERFORMANCE METRICS:\n";
     summaryFile << "Average GiftWrap time: " << (total_gift_time / total_tests) << "ms\n";
     summaryFile << "Average DivideConquer time: " << (total_dc_time / total_tests) << "ms\n";
+    summaryFile << "Average Chan time: " << (total_chan_time / total_tests) << "ms\n";
     summaryFile << "Overall speed ratio (GiftWrap/DivideConquer): " 
                 << (total_gift_time / total_dc_time) << "x\n\n";
     
@@ -393,9 +512,12 @@ int main() {
     summaryFile << "ANALYSIS NOTES:\n";
     summaryFile << "- Scalability tested from 10^2 to 10^6 points\n";
     summaryFile << "- Worst case scenarios: 50%, 90%, 100% hull points\n";
-    summaryFile << "- Large tests with high hull percentages skipped to prevent timeouts\n";
     summaryFile << "- Higher hull percentages stress Gift Wrapping algorithm (O(nh) complexity)\n";
     summaryFile << "- Divide & Conquer shows better asymptotic behavior (O(n log n))\n";
+    summaryFile << "- Filter_Dropped_Points: interior points removed by the Akl-Toussaint octagon before D&C\n";
+    summaryFile << "- Chan is output-sensitive (O(n log h)): compare Random (small h) against high hull percentages\n";
+    summaryFile << "- Approx: strip-based epsilon hull (eps=" << approximationEpsilon << "), Approx_Error is the largest "
+                << "distance from the D&C hull to it and Approx_Speedup is D&C time over Approx time\n";
     
     cout << "\n" << string(60, '=') << "\n";
     cout << "SCALABILITY ANALYSIS COMPLETED!\n";
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "BatchHull/BatchConvexHull/BatchConvexHull.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+class BatchConvexHullTest : public ::testing::Test {
+protected:
+    MonotoneChainAlgorithm<double> monotoneChain;
+
+    // Random clouds of 0 to 50 points on a small integer grid, so duplicates and collinear
+    // points are common
+    void randomBatch(size_t numClouds, unsigned seed, std::vector<Point<double>>& points, std::vector<size_t>& offsets) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> size(0, 50);
+        std::uniform_int_distribution<int> coordinate(0, 8);
+        offsets.assign(1, 0);
+        for (size_t c = 0; c < numClouds; c++) {
+            int n = size(gen);
+            for (int i = 0; i < n; i++) {
+                points.emplace_back(coordinate(gen), coordinate(gen));
+            }
+            offsets.push_back(points.size());
+        }
+    }
+
+    void expectMatchesMonotoneChain(const std::vector<Point<double>>& points, const std::vector<size_t>& offsets,
+                                    const std::vector<Point<double>>& hulls, const std::vector<size_t>& hullOffsets) {
+        ASSERT_EQ(hullOffsets.size(), offsets.size());
+        EXPECT_EQ(hullOffsets.back(), hulls.size());
+        for (size_t c = 0; c + 1 < offsets.size(); c++) {
+            std::vector<Point<double>> cloud(points.begin() + offsets[c], points.begin() + offsets[c + 1]);
+            Poligon<double> expected = monotoneChain.apply(cloud);
+            ASSERT_EQ(hullOffsets[c + 1] - hullOffsets[c], expected.numVertexes()) << "cloud " << c;
+            for (size_t i = 0; i < expected.numVertexes(); i++) {
+                EXPECT_EQ(hulls[hullOffsets[c] + i], expected[i]);
+            }
+        }
+    }
+};
+
+TEST_F(BatchConvexHullTest, MatchesMonotoneChainPerCloud) {
+    std::vector<Point<double>> points;
+    std::vector<size_t> offsets;
+    randomBatch(2000, 3, points, offsets);
+
+    BatchConvexHull<double> batch;
+    std::vector<Point<double>> hulls;
+    std::vector<size_t> hullOffsets;
+    batch.apply(points, offsets, hulls, hullOffsets);
+    expectMatchesMonotoneChain(points, offsets, hulls, hullOffsets);
+}
+
+TEST_F(BatchConvexHullTest, ParallelMatchesSequential) {
+    std::vector<Point<double>> points;
+    std::vector<size_t> offsets;
+    randomBatch(5000, 4, points, offsets);
+
+    BatchConvexHull<double> parallel(4, 64);
+    std::vector<Point<double>> hulls;
+    std::vector<size_t> hullOffsets;
+    parallel.apply(points, offsets, hulls, hullOffsets);
+    expectMatchesMonotoneChain(points, offsets, hulls, hullOffsets);
+}
+
+TEST_F(BatchConvexHullTest, EmptyBatch) {
+    BatchConvexHull<double> batch;
+    std::vector<Point<double>> hulls = {Point<double>(1.0, 1.0)};
+    std::vector<size_t> hullOffsets;
+    batch.apply({}, {0}, hulls, hullOffsets);
+    EXPECT_TRUE(hulls.empty());
+    EXPECT_EQ(hullOffsets, std::vector<size_t>{0});
+
+    batch.apply({}, {}, hulls, hullOffsets);
+    EXPECT_EQ(hullOffsets, std::vector<size_t>{0});
+}
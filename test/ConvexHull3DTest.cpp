@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Polyhedron/Polyhedron.h"
+#include "ConvexHull3DStrategy/IncrementalHull3DAlgorithm/IncrementalHull3DAlgorithm.h"
+
+class ConvexHull3DTest : public ::testing::Test {
+protected:
+    IncrementalHull3DAlgorithm<double> incremental;
+
+    // Every point of the cloud is on the inner side of every face
+    template <typename T>
+    void expectContains(const Polyhedron<T>& hull, const std::vector<Point3<T>>& cloud, double tolerance) {
+        for (size_t f = 0; f < hull.numFaces(); ++f) {
+            const std::array<size_t, 3>& face = hull.face(f);
+            Vector<double> a(hull.vertex(face[0]).getX(), hull.vertex(face[0]).getY(), hull.vertex(face[0]).getZ());
+            Vector<double> b(hull.vertex(face[1]).getX(), hull.vertex(face[1]).getY(), hull.vertex(face[1]).getZ());
+            Vector<double> c(hull.vertex(face[2]).getX(), hull.vertex(face[2]).getY(), hull.vertex(face[2]).getZ());
+            Vector<double> normal = (b - a).cross(c - a);
+            for (const Point3<T>& p : cloud) {
+                Vector<double> q(p.getX(), p.getY(), p.getZ());
+                ASSERT_LE(normal.dot(q - a), tolerance);
+            }
+        }
+    }
+
+    template <typename T>
+    void expectSphereTopology(const Polyhedron<T>& hull) {
+        EXPECT_TRUE(hull.isClosed());
+        // Euler: V - E + F = 2 with E = 3F / 2
+        EXPECT_EQ(hull.numFaces(), 2 * hull.numVertexes() - 4);
+    }
+};
+
+TEST_F(ConvexHull3DTest, PolyhedronVolumeAndClosure) {
+    std::vector<Point3<double>> vertexes = {
+        Point3<double>(0.0, 0.0, 0.0), Point3<double>(1.0, 0.0, 0.0),
+        Point3<double>(0.0, 1.0, 0.0), Point3<double>(0.0, 0.0, 1.0)
+    };
+    Polyhedron<double> tetrahedron(vertexes, {{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {0, 3, 2}});
+    EXPECT_TRUE(tetrahedron.isClosed());
+    EXPECT_DOUBLE_EQ(tetrahedron.volume(), 1.0 / 6.0);
+
+    Polyhedron<double> open(vertexes, {{0, 2, 1}, {0, 1, 3}, {1, 2, 3}});
+    EXPECT_FALSE(open.isClosed());
+}
+
+TEST_F(ConvexHull3DTest, CubeWithInteriorPoints) {
+    std::vector<Point3<double>> cloud;
+    for (int corner = 0; corner < 8; ++corner) {
+        cloud.emplace_back((corner & 1) ? 1.0 : -1.0, (corner & 2) ? 1.0 : -1.0, (corner & 4) ? 1.0 : -1.0);
+    }
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> inside(-0.9, 0.9);
+    for (int i = 0; i < 500; ++i) {
+        cloud.emplace_back(inside(gen), inside(gen), inside(gen));
+    }
+
+    Polyhedron<double> hull = incremental.apply(cloud);
+    EXPECT_EQ(hull.numVertexes(), 8);
+    EXPECT_EQ(hull.numFaces(), 12);
+    EXPECT_TRUE(hull.isClosed());
+    EXPECT_NEAR(hull.volume(), 8.0, 1e-9);
+    expectContains(hull, cloud, 1e-9);
+}
+
+TEST_F(ConvexHull3DTest, RandomBall) {
+    std::mt19937 gen(11);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> radius(0.0, 1.0);
+    std::vector<Point3<double>> cloud;
+    for (int i = 0; i < 5000; ++i) {
+        double x = normal(gen), y = normal(gen), z = normal(gen);
+        double r = std::cbrt(radius(gen)) * 100.0 / std::sqrt(x * x + y * y + z * z);
+        cloud.emplace_back(x * r, y * r, z * r);
+    }
+
+    Polyhedron<double> hull = incremental.apply(cloud);
+    expectSphereTopology(hull);
+    EXPECT_GT(hull.volume(), 0.0);
+    EXPECT_LT(hull.volume(), 4.0 / 3.0 * M_PI * 1e6);
+    expectContains(hull, cloud, 1e-6);
+}
+
+TEST_F(ConvexHull3DTest, AllPointsOnSphere) {
+    std::mt19937 gen(3);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::vector<Point3<double>> cloud;
+    for (int i = 0; i < 2000; ++i) {
+        double x = normal(gen), y = normal(gen), z = normal(gen);
+        double r = 10.0 / std::sqrt(x * x + y * y + z * z);
+        cloud.emplace_back(x * r, y * r, z * r);
+    }
+
+    Polyhedron<double> hull = incremental.apply(cloud);
+    expectSphereTopology(hull);
+    EXPECT_EQ(hull.numVertexes(), cloud.size());
+    expectContains(hull, cloud, 1e-9);
+}
+
+TEST_F(ConvexHull3DTest, IntegerGridWithDuplicates) {
+    // Coplanar points on every face and repeated points, decided exactly
+    std::vector<Point3<int>> cloud;
+    for (int x = 0; x <= 4; ++x) {
+        for (int y = 0; y <= 4; ++y) {
+            for (int z = 0; z <= 4; ++z) {
+                cloud.emplace_back(x, y, z);
+                cloud.emplace_back(x, y, z);
+            }
+        }
+    }
+
+    IncrementalHull3DAlgorithm<int> exact;
+    Polyhedron<int> hull = exact.apply(cloud);
+    expectSphereTopology(hull);
+    EXPECT_EQ(hull.volume(), 64);
+    expectContains(hull, cloud, 0.0);
+}
+
+TEST_F(ConvexHull3DTest, IntegerVolumeDoesNotOverflow) {
+    // Triple products of coordinates past 1300 no longer fit in int
+    std::vector<Point3<int>> cube;
+    for (int corner = 0; corner < 8; ++corner) {
+        cube.emplace_back(corner & 1 ? 4000 : 1000, corner & 2 ? 4000 : 1000, corner & 4 ? 4000 : 1000);
+    }
+    IncrementalHull3DAlgorithm<int> exact;
+    EXPECT_EQ(exact.apply(cube).volume(), 27e9);
+
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<int> coordinate(-1000000, 1000000);
+    std::vector<Point3<int>> cloud;
+    std::vector<Point3<double>> asDouble;
+    for (int i = 0; i < 500; ++i) {
+        cloud.emplace_back(coordinate(gen), coordinate(gen), coordinate(gen));
+        asDouble.emplace_back(cloud.back().getX(), cloud.back().getY(), cloud.back().getZ());
+    }
+    double expected = IncrementalHull3DAlgorithm<double>().apply(asDouble).volume();
+    EXPECT_NEAR(exact.apply(cloud).volume(), expected, 1e-9 * expected);
+}
+
+TEST_F(ConvexHull3DTest, IntegerMinimumCoordinates) {
+    std::vector<Point3<int>> cloud = {
+        Point3<int>(INT_MIN, 0, 0), Point3<int>(0, INT_MIN, 0), Point3<int>(0, 0, INT_MIN),
+        Point3<int>(INT_MAX, INT_MAX, INT_MAX), Point3<int>(0, 0, 0)
+    };
+    Polyhedron<int> hull = IncrementalHull3DAlgorithm<int>().apply(cloud);
+    expectSphereTopology(hull);
+    EXPECT_EQ(hull.numVertexes(), 4u);
+    expectContains(hull, cloud, 0.0);
+}
+
+TEST_F(ConvexHull3DTest, SeedOnlyChangesInsertionOrder) {
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    std::vector<Point3<int>> cloud;
+    for (int i = 0; i < 3000; ++i) {
+        cloud.emplace_back(coordinate(gen), coordinate(gen), coordinate(gen));
+    }
+
+    IncrementalHull3DAlgorithm<int> first(1);
+    IncrementalHull3DAlgorithm<int> second(2);
+    Polyhedron<int> a = first.apply(cloud);
+    Polyhedron<int> b = second.apply(cloud);
+    EXPECT_TRUE(a.isClosed());
+    EXPECT_EQ(a.volume(), b.volume());
+    expectContains(a, cloud, 0.0);
+    expectContains(b, cloud, 0.0);
+}
+
+TEST_F(ConvexHull3DTest, DegenerateClouds) {
+    EXPECT_EQ(incremental.apply({}).numVertexes(), 0);
+
+    std::vector<Point3<double>> repeated(5, Point3<double>(1.0, 2.0, 3.0));
+    Polyhedron<double> single = incremental.apply(repeated);
+    EXPECT_EQ(single.numVertexes(), 1);
+    EXPECT_EQ(single.numFaces(), 0);
+
+    std::vector<Point3<double>> collinear;
+    for (int i = 0; i < 10; ++i) {
+        collinear.emplace_back(i, 2.0 * i, 3.0 * i);
+    }
+    Polyhedron<double> segment = incremental.apply(collinear);
+    EXPECT_EQ(segment.numVertexes(), 2);
+    EXPECT_EQ(segment.numFaces(), 0);
+
+    std::vector<Point3<double>> coplanar;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            coplanar.emplace_back(i, j, 5.0);
+        }
+    }
+    Polyhedron<double> flat = incremental.apply(coplanar);
+    EXPECT_EQ(flat.numVertexes(), 3);
+    EXPECT_EQ(flat.numFaces(), 0);
+}
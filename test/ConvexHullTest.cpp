@@ -1,9 +1,21 @@
 #include <gtest/gtest.h>
 #include <vector>
+#include <algorithm>
+#include <random>
 #include "Point/Point.h"
 #include "Poligon/Poligon.h"
 #include "ConvexHullStrategy/GiftWrappingAlgorithm/GiftWrappingAlgorithm.h"
 #include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/ChanAlgorithm/ChanAlgorithm.h"
+#include "ConvexHullStrategy/QuickHullAlgorithm/QuickHullAlgorithm.h"
+#include "ConvexHullStrategy/AklToussaintFilter/AklToussaintFilter.h"
+#include "ConvexHullStrategy/ApproximateHullAlgorithm/ApproximateHullAlgorithm.h"
+#include "DynamicHull/DynamicConvexHull/DynamicConvexHull.h"
+#include "DynamicHull/OnlineConvexHull/OnlineConvexHull.h"
+#include "PointCloud/PointCloud.h"
+#include "PointGenerationStrategy/RandomPointStrategy/RandomPointStrategy.h"
+#include "PointGenerationStrategy/HullPercentageStrategy/HullPercentageStrategy.h"
 
 class ConvexHullTest : public ::testing::Test {
 protected:
@@ -101,6 +113,31 @@ TEST_F(ConvexHullTest, GiftWrappingCollinear) {
     EXPECT_DOUBLE_EQ(hull.area(), 0.0);
 }
 
+TEST_F(ConvexHullTest, GiftWrappingRepeatedPoint) {
+    std::vector<Point<double>> repeated(10, Point<double>(1.0, 1.0));
+    GiftWrappingAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(repeated);
+    
+    EXPECT_EQ(hull.numVertexes(), 1);
+}
+
+TEST_F(ConvexHullTest, GiftWrappingParallelMatchesSequential) {
+    HullPercentageStrategy<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(5000, 50.0);
+
+    // A tiny cutoff splits every candidate scan across the pool
+    GiftWrappingAlgorithm<double> parallel(4, 64);
+    GiftWrappingAlgorithm<double> sequential;
+
+    Poligon<double> hullParallel = parallel.apply(cloud);
+    Poligon<double> hullSequential = sequential.apply(cloud);
+
+    ASSERT_EQ(hullParallel.numVertexes(), hullSequential.numVertexes());
+    for (size_t i = 0; i < hullParallel.numVertexes(); ++i) {
+        EXPECT_EQ(hullParallel[i], hullSequential[i]);
+    }
+}
+
 TEST_F(ConvexHullTest, DivideAndConquerSquare) {
     DivideAndConquerAlgorithm<double> algorithm;
     Poligon<double> hull = algorithm.apply(squarePoints);
@@ -141,6 +178,94 @@ TEST_F(ConvexHullTest, DivideAndConquerTwoPoints) {
     EXPECT_DOUBLE_EQ(hull.area(), 0.0);
 }
 
+TEST_F(ConvexHullTest, DivideAndConquerCollinear) {
+    DivideAndConquerAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(collinearPoints);
+    
+    EXPECT_EQ(hull.numVertexes(), 2);
+    EXPECT_DOUBLE_EQ(hull.area(), 0.0);
+}
+
+TEST_F(ConvexHullTest, DivideAndConquerIntegerGridWithDuplicates) {
+    std::vector<Point<int>> grid;
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        for (int x = 0; x <= 15; ++x) {
+            for (int y = 0; y <= 9; ++y) {
+                grid.push_back(Point<int>(x, y));
+            }
+        }
+    }
+    
+    DivideAndConquerAlgorithm<int> algorithm;
+    Poligon<int> hull = algorithm.apply(grid);
+    
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_EQ(hull.area(), 135);
+    EXPECT_TRUE(hull.isCCW());
+}
+
+TEST_F(ConvexHullTest, DivideAndConquerParallelMatchesSequential) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(50000);
+
+    // A tiny grain size forces the fork-join path and the parallel sort
+    DivideAndConquerAlgorithm<double> parallel(4, 64);
+    DivideAndConquerAlgorithm<double> sequential;
+
+    Poligon<double> hullParallel = parallel.apply(cloud);
+    Poligon<double> hullSequential = sequential.apply(cloud);
+
+    ASSERT_EQ(hullParallel.numVertexes(), hullSequential.numVertexes());
+    for (size_t i = 0; i < hullParallel.numVertexes(); ++i) {
+        EXPECT_EQ(hullParallel[i], hullSequential[i]);
+    }
+}
+
+TEST_F(ConvexHullTest, GiftWrappingIsCounterClockwise) {
+    GiftWrappingAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(pointsWithInterior);
+
+    ASSERT_EQ(hull.numVertexes(), 4u);
+    EXPECT_EQ(hull[0], Point<double>(0.0, 0.0));
+    EXPECT_EQ(hull[1], Point<double>(4.0, 0.0));
+    EXPECT_EQ(hull[2], Point<double>(4.0, 4.0));
+    EXPECT_EQ(hull[3], Point<double>(0.0, 4.0));
+}
+
+// Every hull built with the convexCCW flag must really be CCW, since the flag skips the check
+TEST_F(ConvexHullTest, FlaggedHullsHavePositiveArea) {
+    RandomPointGenerator<double> generator;
+    std::vector<std::vector<Point<double>>> clouds = {pointsWithInterior, trianglePoints, generator.generate(3000)};
+
+    GiftWrappingAlgorithm<double> giftWrap;
+    GiftWrappingAlgorithm<double> parallelGiftWrap(4, 64);
+    DivideAndConquerAlgorithm<double> divideConquer;
+    MonotoneChainAlgorithm<double> monotoneChain;
+    ChanAlgorithm<double> chan;
+    QuickHullAlgorithm<double> quickHull;
+    AklToussaintFilter<double> filtered(giftWrap);
+    std::vector<AConvexHullStrategy<double>*> strategies = {&giftWrap, &parallelGiftWrap, &divideConquer,
+                                                            &monotoneChain, &chan, &quickHull, &filtered};
+    for (const std::vector<Point<double>>& cloud : clouds) {
+        PointCloud<double> columns(cloud);
+        for (AConvexHullStrategy<double>* strategy : strategies) {
+            Poligon<double> hull = strategy->apply(cloud);
+            EXPECT_TRUE(hull.isCCW());
+            EXPECT_GT(hull.signedArea(), 0.0);
+            EXPECT_GT(strategy->applyCloud(columns).signedArea(), 0.0);
+        }
+
+        DynamicConvexHull<double> dynamic;
+        OnlineConvexHull<double> online;
+        for (const Point<double>& point : cloud) {
+            dynamic.insert(point);
+            online.insert(point);
+        }
+        EXPECT_GT(dynamic.hull().signedArea(), 0.0);
+        EXPECT_GT(online.hull().signedArea(), 0.0);
+    }
+}
+
 TEST_F(ConvexHullTest, CompareAlgorithms) {
     GiftWrappingAlgorithm<double> giftWrap;
     DivideAndConquerAlgorithm<double> divideConquer;
@@ -168,3 +293,380 @@ TEST_F(ConvexHullTest, IntegerPoints) {
     EXPECT_EQ(hull.numVertexes(), 4);
     EXPECT_EQ(hull.area(), 9);
 }
+
+TEST_F(ConvexHullTest, IntegerPointsNearLimits) {
+    // Differences overflow int and products overflow int64; collinear edge points must not
+    // survive either
+    const int big = 2000000000;
+    std::vector<Point<int>> intPoints = {
+        Point<int>(-big, -big),
+        Point<int>(0, -big),
+        Point<int>(big, -big),
+        Point<int>(big, big),
+        Point<int>(big, 0),
+        Point<int>(-big, big),
+        Point<int>(1, -big + 1),
+        Point<int>(big - 1, big - 1),
+        Point<int>(-big, -big)
+    };
+    std::vector<Point<int>> corners = {
+        Point<int>(-big, -big), Point<int>(big, -big), Point<int>(big, big), Point<int>(-big, big)
+    };
+    
+    GiftWrappingAlgorithm<int> giftWrap;
+    DivideAndConquerAlgorithm<int> divideConquer;
+    MonotoneChainAlgorithm<int> monotoneChain;
+    ChanAlgorithm<int> chan;
+    QuickHullAlgorithm<int> quickHull;
+    AklToussaintFilter<int> filtered(divideConquer);
+    std::vector<AConvexHullStrategy<int>*> strategies = {&giftWrap, &divideConquer, &monotoneChain, &chan, &quickHull, &filtered};
+    for (AConvexHullStrategy<int>* strategy : strategies) {
+        Poligon<int> hull = strategy->apply(intPoints);
+        ASSERT_EQ(hull.numVertexes(), 4u);
+        for (const Point<int>& corner : corners) {
+            bool found = false;
+            for (size_t i = 0; i < hull.numVertexes(); i++) {
+                found |= hull[i] == corner;
+            }
+            EXPECT_TRUE(found);
+        }
+    }
+}
+
+TEST_F(ConvexHullTest, MonotoneChainSquare) {
+    MonotoneChainAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(squarePoints);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.area(), 4.0);
+    EXPECT_TRUE(hull.isCCW());
+}
+
+TEST_F(ConvexHullTest, MonotoneChainWithInteriorPoints) {
+    MonotoneChainAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(pointsWithInterior);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.area(), 16.0);
+}
+
+TEST_F(ConvexHullTest, MonotoneChainCollinear) {
+    MonotoneChainAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(collinearPoints);
+
+    EXPECT_EQ(hull.numVertexes(), 2);
+    EXPECT_DOUBLE_EQ(hull.area(), 0.0);
+}
+
+TEST_F(ConvexHullTest, MonotoneChainPresortedInput) {
+    std::vector<Point<double>> sorted = pointsWithInterior;
+    std::sort(sorted.begin(), sorted.end(), [](const Point<double>& a, const Point<double>& b) {
+        return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+    });
+
+    MonotoneChainAlgorithm<double> checked;
+    MonotoneChainAlgorithm<double> trusted(true);
+
+    Poligon<double> hullChecked = checked.apply(sorted);
+    Poligon<double> hullTrusted = trusted.apply(sorted);
+
+    EXPECT_EQ(hullTrusted.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hullTrusted.area(), 16.0);
+    EXPECT_EQ(hullChecked.numVertexes(), hullTrusted.numVertexes());
+    for (size_t i = 0; i < hullTrusted.numVertexes(); ++i) {
+        EXPECT_TRUE(hullChecked[i] == hullTrusted[i]);
+    }
+}
+
+TEST_F(ConvexHullTest, MonotoneChainMatchesDivideAndConquer) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(2000);
+
+    MonotoneChainAlgorithm<double> monotone;
+    DivideAndConquerAlgorithm<double> divideConquer;
+
+    Poligon<double> hullMonotone = monotone.apply(cloud);
+    Poligon<double> hullDivide = divideConquer.apply(cloud);
+
+    EXPECT_EQ(hullMonotone.numVertexes(), hullDivide.numVertexes());
+    EXPECT_NEAR(hullMonotone.area(), hullDivide.area(), 1e-6);
+}
+
+TEST_F(ConvexHullTest, MonotoneChainZeroCopyViews) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(2000);
+    cloud.insert(cloud.end(), pointsWithInterior.begin(), pointsWithInterior.end());
+
+    MonotoneChainAlgorithm<double> monotone;
+    Poligon<double> expected = monotone.apply(cloud);
+
+    std::vector<double> xs, ys, interleaved;
+    for (const Point<double>& point : cloud) {
+        xs.push_back(point.getX());
+        ys.push_back(point.getY());
+        interleaved.push_back(point.getX());
+        interleaved.push_back(point.getY());
+    }
+
+    std::vector<size_t> fromPoints, fromColumns, fromInterleaved;
+    monotone.apply(cloud.data(), cloud.size(), fromPoints);
+    monotone.apply(xs.data(), ys.data(), xs.size(), fromColumns);
+    monotone.apply(interleaved.data(), interleaved.data() + 1, cloud.size(), fromInterleaved, 2);
+
+    ASSERT_EQ(fromPoints.size(), expected.numVertexes());
+    EXPECT_EQ(fromColumns, fromPoints);
+    EXPECT_EQ(fromInterleaved, fromPoints);
+    for (size_t i = 0; i < fromPoints.size(); ++i) {
+        EXPECT_TRUE(cloud[fromPoints[i]] == expected[i]);
+    }
+}
+
+TEST_F(ConvexHullTest, MonotoneChainZeroCopyDegenerate) {
+    MonotoneChainAlgorithm<int> monotone;
+    std::vector<size_t> hull;
+
+    std::vector<int> repeated = {3, 3, 3, 3};
+    monotone.apply(repeated.data(), repeated.data(), repeated.size(), hull);
+    EXPECT_EQ(hull, std::vector<size_t>{0});
+
+    std::vector<int> xs = {0, 2, 1, 3};
+    std::vector<int> ys = {0, 2, 1, 3};
+    monotone.apply(xs.data(), ys.data(), xs.size(), hull);
+    EXPECT_EQ(hull, (std::vector<size_t>{0, 3}));
+
+    monotone.apply(xs.data(), ys.data(), 2, hull);
+    EXPECT_EQ(hull, (std::vector<size_t>{0, 1}));
+}
+
+TEST_F(ConvexHullTest, ChanWithInteriorPoints) {
+    ChanAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(pointsWithInterior);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.area(), 16.0);
+    EXPECT_TRUE(hull.isCCW());
+}
+
+TEST_F(ConvexHullTest, ChanCollinear) {
+    ChanAlgorithm<double> algorithm;
+    Poligon<double> hull = algorithm.apply(collinearPoints);
+
+    EXPECT_EQ(hull.numVertexes(), 2);
+    EXPECT_DOUBLE_EQ(hull.area(), 0.0);
+}
+
+TEST_F(ConvexHullTest, ChanIntegerGridWithDuplicates) {
+    std::vector<Point<int>> grid;
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        for (int x = 0; x <= 20; ++x) {
+            for (int y = 0; y <= 20; ++y) {
+                grid.push_back(Point<int>(x, y));
+            }
+        }
+    }
+
+    ChanAlgorithm<int> algorithm;
+    Poligon<int> hull = algorithm.apply(grid);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_EQ(hull.area(), 400);
+}
+
+TEST_F(ConvexHullTest, ChanMatchesDivideAndConquer) {
+    RandomPointGenerator<double> randomGen;
+    HullPercentageStrategy<double> hullGen;
+    DivideAndConquerAlgorithm<double> divideConquer;
+    ChanAlgorithm<double> chan;
+
+    for (const auto& cloud : {randomGen.generate(5000), hullGen.generate(2000, 50.0)}) {
+        Poligon<double> hullChan = chan.apply(cloud);
+        Poligon<double> hullDivide = divideConquer.apply(cloud);
+
+        EXPECT_EQ(hullChan.numVertexes(), hullDivide.numVertexes());
+        EXPECT_NEAR(hullChan.area(), hullDivide.area(), 1e-6);
+    }
+}
+
+TEST_F(ConvexHullTest, QuickHullWithInteriorPoints) {
+    QuickHullAlgorithm<double> algorithm(2);
+    Poligon<double> hull = algorithm.apply(pointsWithInterior);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.area(), 16.0);
+    EXPECT_TRUE(hull.isCCW());
+}
+
+TEST_F(ConvexHullTest, QuickHullCollinear) {
+    QuickHullAlgorithm<double> algorithm(2);
+    Poligon<double> hull = algorithm.apply(collinearPoints);
+
+    EXPECT_EQ(hull.numVertexes(), 2);
+    EXPECT_DOUBLE_EQ(hull.area(), 0.0);
+}
+
+TEST_F(ConvexHullTest, QuickHullIntegerGridTies) {
+    std::vector<Point<int>> grid;
+    for (int x = 0; x <= 30; ++x) {
+        for (int y = 0; y <= 10; ++y) {
+            grid.push_back(Point<int>(x, y));
+        }
+    }
+
+    QuickHullAlgorithm<int> algorithm(4, 8);
+    Poligon<int> hull = algorithm.apply(grid);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_EQ(hull.area(), 300);
+}
+
+TEST_F(ConvexHullTest, QuickHullParallelMatchesDivideAndConquer) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(50000);
+
+    // A tiny cutoff forces the task-parallel path even on small inputs
+    QuickHullAlgorithm<double> quickHull(4, 256);
+    DivideAndConquerAlgorithm<double> divideConquer;
+
+    Poligon<double> hullQuick = quickHull.apply(cloud);
+    Poligon<double> hullDivide = divideConquer.apply(cloud);
+
+    EXPECT_EQ(hullQuick.numVertexes(), hullDivide.numVertexes());
+    EXPECT_NEAR(hullQuick.area(), hullDivide.area(), 1e-6);
+}
+
+TEST_F(ConvexHullTest, QuickHullNearCollinearMatchesMonotoneChain) {
+    // Points rounded onto a segment are nearly equally far from many lines, where a rounded
+    // distance comparison picks an apex inside the hull
+    QuickHullAlgorithm<double> sequential(1);
+    QuickHullAlgorithm<double> parallel(4, 4);
+    MonotoneChainAlgorithm<double> monotoneChain;
+    for (unsigned seed = 0; seed < 300; ++seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        double ax = unit(gen), ay = unit(gen), bx = 100 * unit(gen), by = 100 * unit(gen);
+        std::vector<Point<double>> cloud;
+        for (int i = 0; i < 40; ++i) {
+            double t = unit(gen);
+            cloud.emplace_back(ax + t * (bx - ax), ay + t * (by - ay));
+        }
+        for (int i = 0; i < 4; ++i) {
+            cloud.emplace_back(100 * unit(gen), 100 * unit(gen));
+        }
+
+        Poligon<double> expected = monotoneChain.apply(cloud);
+        for (QuickHullAlgorithm<double>* quickHull : {&sequential, &parallel}) {
+            Poligon<double> hull = quickHull->apply(cloud);
+            ASSERT_EQ(hull.numVertexes(), expected.numVertexes()) << "seed " << seed;
+            for (size_t i = 0; i < hull.numVertexes(); ++i) {
+                EXPECT_EQ(hull[i], expected[i]);
+            }
+        }
+    }
+}
+
+TEST_F(ConvexHullTest, AklToussaintDropsInteriorPoints) {
+    DivideAndConquerAlgorithm<double> divideConquer;
+    AklToussaintFilter<double> filter(divideConquer);
+
+    Poligon<double> hull = filter.apply(pointsWithInterior);
+
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.area(), 16.0);
+    EXPECT_EQ(filter.lastDroppedCount(), 3);
+}
+
+TEST_F(ConvexHullTest, AklToussaintDegenerateInput) {
+    GiftWrappingAlgorithm<double> giftWrap;
+    AklToussaintFilter<double> filter(giftWrap);
+
+    Poligon<double> hull = filter.apply(collinearPoints);
+    EXPECT_EQ(hull.numVertexes(), 2);
+    EXPECT_EQ(filter.lastDroppedCount(), 0);
+
+    hull = filter.apply(singlePoint);
+    EXPECT_EQ(hull.numVertexes(), 1);
+    EXPECT_EQ(filter.lastDroppedCount(), 0);
+}
+
+TEST_F(ConvexHullTest, AklToussaintMatchesUnfilteredStrategy) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(20000);
+
+    DivideAndConquerAlgorithm<double> divideConquer;
+    AklToussaintFilter<double> filter(divideConquer);
+
+    Poligon<double> hullFiltered = filter.apply(cloud);
+    Poligon<double> hullDivide = divideConquer.apply(cloud);
+
+    EXPECT_EQ(hullFiltered.numVertexes(), hullDivide.numVertexes());
+    EXPECT_NEAR(hullFiltered.area(), hullDivide.area(), 1e-6);
+    // Uniform clouds lose the vast majority of their points to the octagon
+    EXPECT_GT(filter.lastDroppedCount(), cloud.size() / 2);
+}
+
+TEST_F(ConvexHullTest, ApproximateHullWithinEpsilon) {
+    RandomPointGenerator<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(50000);
+
+    ApproximateHullAlgorithm<double> approximate(50.0);
+    DivideAndConquerAlgorithm<double> divideConquer;
+    Poligon<double> hull = approximate.apply(cloud);
+    Poligon<double> exact = divideConquer.apply(cloud);
+
+    EXPECT_TRUE(hull.isCCW());
+    EXPECT_GT(approximate.lastStripCount(), 0);
+    EXPECT_LE(hull.numVertexes(), 2 * approximate.lastStripCount() + 4);
+    EXPECT_LE(approximate.lastError(), 50.0);
+    // Always inside the exact hull, and no thinner than epsilon around it
+    EXPECT_LE(hull.area(), exact.area() + 1e-6);
+    EXPECT_GT(hull.area(), exact.area() - 4 * 10000.0 * 50.0);
+}
+
+TEST_F(ConvexHullTest, ApproximateHullVertexBudget) {
+    HullPercentageStrategy<double> generator;
+    std::vector<Point<double>> cloud = generator.generate(20000, 100.0);
+
+    ApproximateHullAlgorithm<double> approximate(0.0, 20);
+    Poligon<double> hull = approximate.apply(cloud);
+
+    double xmin = cloud[0].getX(), xmax = cloud[0].getX();
+    for (const auto& p : cloud) {
+        xmin = std::min(xmin, p.getX());
+        xmax = std::max(xmax, p.getX());
+    }
+    EXPECT_EQ(approximate.lastStripCount(), 8);
+    EXPECT_LE(hull.numVertexes(), 20);
+    EXPECT_GT(approximate.lastError(), 0.0);
+    EXPECT_LE(approximate.lastError(), (xmax - xmin) / 8);
+}
+
+TEST_F(ConvexHullTest, ApproximateHullFallsBackToExact) {
+    ApproximateHullAlgorithm<double> approximate(1e-9);
+    DivideAndConquerAlgorithm<double> divideConquer;
+
+    Poligon<double> hull = approximate.apply(pointsWithInterior);
+    EXPECT_EQ(approximate.lastStripCount(), 0);
+    EXPECT_EQ(approximate.lastError(), 0.0);
+    EXPECT_EQ(hull.numVertexes(), divideConquer.apply(pointsWithInterior).numVertexes());
+
+    hull = approximate.apply(collinearPoints);
+    EXPECT_EQ(hull.numVertexes(), 2);
+}
+
+TEST_F(ConvexHullTest, ApproximateHullIntegerGrid) {
+    std::vector<Point<int>> grid;
+    for (int x = 0; x <= 100; ++x) {
+        for (int y = 0; y <= 100; ++y) {
+            grid.emplace_back(x, y);
+            if ((x + y) % 3 == 0) grid.emplace_back(x, y);
+        }
+    }
+
+    // A square is recovered exactly: its corners are the x-extremes
+    ApproximateHullAlgorithm<int> approximate(10.0);
+    Poligon<int> hull = approximate.apply(grid);
+    EXPECT_EQ(approximate.lastStripCount(), 10);
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_EQ(hull.area(), 10000);
+    EXPECT_EQ(approximate.lastError(), 0.0);
+}
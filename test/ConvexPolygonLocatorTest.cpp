@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "PointCloud/PointCloud.h"
+#include "PointLocation/ConvexPolygonLocator/ConvexPolygonLocator.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+class ConvexPolygonLocatorTest : public ::testing::Test {
+protected:
+    // Linear scan over every edge, the way callers classified points before
+    template <typename T>
+    PointLocation bruteForce(const Poligon<T>& hull, const Point<T>& p) {
+        size_t h = hull.numVertexes();
+        bool onEdge = false;
+        for (size_t i = 0; i < h; i++) {
+            const Point<T>& a = hull[i];
+            const Point<T>& b = hull[(i + 1) % h];
+            int turn = OrientationPredicate<T>::sign(a.getX(), a.getY(), b.getX(), b.getY(), p.getX(), p.getY());
+            if (turn < 0) return PointLocation::OUTSIDE;
+            onEdge = onEdge || turn == 0;
+        }
+        return onEdge ? PointLocation::BOUNDARY : PointLocation::INSIDE;
+    }
+
+    // Hull of a random grid cloud and queries on the same grid, so boundary hits are common
+    template <typename T>
+    void expectMatchesBruteForce(unsigned seed, int gridSize, size_t numThreads) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(0, gridSize);
+        std::vector<Point<T>> cloud;
+        for (int i = 0; i < 200; i++) {
+            cloud.emplace_back(T(coordinate(gen)), T(coordinate(gen)));
+        }
+        Poligon<T> hull = MonotoneChainAlgorithm<T>().apply(cloud);
+        ConvexPolygonLocator<T> locator(hull, numThreads, 256);
+
+        std::uniform_int_distribution<int> query(-2, gridSize + 2);
+        std::vector<Point<T>> queries;
+        for (int i = 0; i < 5000; i++) {
+            queries.emplace_back(T(query(gen)), T(query(gen)));
+        }
+        std::vector<PointLocation> batched;
+        locator.locate(queries.data(), queries.size(), batched);
+        ASSERT_EQ(batched.size(), queries.size());
+
+        size_t boundaryHits = 0;
+        for (size_t i = 0; i < queries.size(); i++) {
+            PointLocation expected = bruteForce(hull, queries[i]);
+            EXPECT_EQ(locator.locate(queries[i]), expected) << "query " << i;
+            EXPECT_EQ(batched[i], expected) << "query " << i;
+            boundaryHits += expected == PointLocation::BOUNDARY;
+        }
+        EXPECT_GT(boundaryHits, 0u);
+    }
+};
+
+TEST_F(ConvexPolygonLocatorTest, MatchesBruteForceDouble) {
+    expectMatchesBruteForce<double>(1, 40, 1);
+}
+
+TEST_F(ConvexPolygonLocatorTest, MatchesBruteForceFloatAndInt) {
+    expectMatchesBruteForce<float>(2, 30, 1);
+    expectMatchesBruteForce<int>(3, 50, 1);
+}
+
+TEST_F(ConvexPolygonLocatorTest, ThreadedBatchesMatch) {
+    expectMatchesBruteForce<double>(4, 60, 4);
+}
+
+TEST_F(ConvexPolygonLocatorTest, ColumnsAndClockwiseInput) {
+    // Clockwise, with a duplicate and a vertex in the middle of an edge
+    Poligon<double> square({Point<double>(0.0, 0.0), Point<double>(0.0, 2.0), Point<double>(2.0, 2.0),
+                            Point<double>(2.0, 2.0), Point<double>(2.0, 1.0), Point<double>(2.0, 0.0)});
+    ConvexPolygonLocator<double> locator(square);
+    EXPECT_EQ(locator.locate(Point<double>(1.0, 1.0)), PointLocation::INSIDE);
+    EXPECT_EQ(locator.locate(Point<double>(2.0, 0.5)), PointLocation::BOUNDARY);
+    EXPECT_EQ(locator.locate(Point<double>(0.0, 0.0)), PointLocation::BOUNDARY);
+    EXPECT_EQ(locator.locate(Point<double>(-1.0, 0.0)), PointLocation::OUTSIDE);
+    EXPECT_TRUE(locator.contains(Point<double>(0.0, 1.0)));
+
+    PointCloud<double> cloud({Point<double>(1.0, 1.0), Point<double>(3.0, 1.0), Point<double>(1.0, 2.0)});
+    std::vector<PointLocation> locations;
+    locator.locate(cloud, locations);
+    EXPECT_EQ(locations, (std::vector<PointLocation>{PointLocation::INSIDE, PointLocation::OUTSIDE,
+                                                     PointLocation::BOUNDARY}));
+
+    // Interleaved x, y buffer
+    std::vector<double> interleaved = {1.0, 1.0, 3.0, 1.0, 1.0, 2.0};
+    std::vector<PointLocation> strided(3);
+    locator.locate(interleaved.data(), interleaved.data() + 1, 3, strided.data(), 2);
+    EXPECT_EQ(strided, locations);
+}
+
+TEST_F(ConvexPolygonLocatorTest, DegenerateAndFarQueries) {
+    ConvexPolygonLocator<int> empty(Poligon<int>(std::vector<Point<int>>{}));
+    EXPECT_EQ(empty.locate(Point<int>(0, 0)), PointLocation::OUTSIDE);
+
+    ConvexPolygonLocator<int> segment(Poligon<int>({Point<int>(0, 0), Point<int>(2, 2), Point<int>(4, 4)}));
+    EXPECT_EQ(segment.locate(Point<int>(3, 3)), PointLocation::BOUNDARY);
+    EXPECT_EQ(segment.locate(Point<int>(5, 5)), PointLocation::OUTSIDE);
+    EXPECT_EQ(segment.locate(Point<int>(1, 2)), PointLocation::OUTSIDE);
+
+    // Queries near the int limits leave the 64-bit lanes for the exact path
+    ConvexPolygonLocator<int> triangle(Poligon<int>({Point<int>(0, 0), Point<int>(10, 0), Point<int>(0, 10)}));
+    std::vector<Point<int>> queries = {Point<int>(2000000000, -2000000000), Point<int>(1, 1),
+                                       Point<int>(-2000000000, 5), Point<int>(5, 5)};
+    std::vector<PointLocation> locations;
+    triangle.locate(queries.data(), queries.size(), locations);
+    EXPECT_EQ(locations, (std::vector<PointLocation>{PointLocation::OUTSIDE, PointLocation::INSIDE,
+                                                     PointLocation::OUTSIDE, PointLocation::BOUNDARY}));
+}
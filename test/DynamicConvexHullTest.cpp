@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "DynamicHull/DynamicConvexHull/DynamicConvexHull.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+class DynamicConvexHullTest : public ::testing::Test {
+protected:
+    DynamicConvexHull<double> hull;
+
+    void insertSquareWithInterior() {
+        hull.insert(Point<double>(0.0, 0.0));
+        hull.insert(Point<double>(4.0, 0.0));
+        hull.insert(Point<double>(4.0, 4.0));
+        hull.insert(Point<double>(0.0, 4.0));
+        hull.insert(Point<double>(2.0, 2.0));
+        hull.insert(Point<double>(3.0, 1.0));
+    }
+
+    static bool sameVertexes(const Poligon<int>& a, const Poligon<int>& b) {
+        if (a.numVertexes() != b.numVertexes()) return false;
+        for (size_t i = 0; i < a.numVertexes(); ++i) {
+            if (!(a[i] == b[i])) return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(DynamicConvexHullTest, Empty) {
+    EXPECT_TRUE(hull.empty());
+    EXPECT_EQ(hull.hull().numVertexes(), 0);
+    EXPECT_FALSE(hull.erase(Point<double>(1.0, 1.0)));
+}
+
+TEST_F(DynamicConvexHullTest, InsertKeepsOnlyCorners) {
+    insertSquareWithInterior();
+
+    Poligon<double> result = hull.hull();
+    EXPECT_EQ(hull.size(), 6);
+    EXPECT_EQ(result.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(result.area(), 16.0);
+    EXPECT_TRUE(result.isCCW());
+    EXPECT_EQ(result[0], Point<double>(0.0, 0.0));
+}
+
+TEST_F(DynamicConvexHullTest, EraseExposesInteriorPoint) {
+    insertSquareWithInterior();
+
+    EXPECT_TRUE(hull.erase(Point<double>(4.0, 0.0)));
+    Poligon<double> result = hull.hull();
+
+    EXPECT_EQ(result.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(result.area(), 12.0);
+}
+
+TEST_F(DynamicConvexHullTest, RepeatedPointsAreCounted) {
+    hull.insert(Point<double>(1.0, 1.0));
+    hull.insert(Point<double>(1.0, 1.0));
+    hull.insert(Point<double>(3.0, 1.0));
+
+    EXPECT_TRUE(hull.erase(Point<double>(1.0, 1.0)));
+    EXPECT_EQ(hull.hull().numVertexes(), 2);
+    EXPECT_TRUE(hull.erase(Point<double>(1.0, 1.0)));
+    EXPECT_EQ(hull.hull().numVertexes(), 1);
+    EXPECT_FALSE(hull.erase(Point<double>(1.0, 1.0)));
+}
+
+TEST_F(DynamicConvexHullTest, MatchesRecomputationUnderUpdates) {
+    // A small integer grid produces plenty of collinear and repeated points
+    std::mt19937 gen(7);
+    DynamicConvexHull<int> dynamicHull;
+    MonotoneChainAlgorithm<int> recompute;
+    std::vector<Point<int>> live;
+
+    for (int step = 0; step < 2000; ++step) {
+        if (!live.empty() && gen() % 3 == 0) {
+            size_t index = gen() % live.size();
+            EXPECT_TRUE(dynamicHull.erase(live[index]));
+            live.erase(live.begin() + index);
+        } else {
+            Point<int> point(static_cast<int>(gen() % 12), static_cast<int>(gen() % 12));
+            dynamicHull.insert(point);
+            live.push_back(point);
+        }
+
+        if (live.size() >= 3) {
+            ASSERT_TRUE(sameVertexes(dynamicHull.hull(), recompute.apply(live))) << "step " << step;
+        }
+    }
+}
+
+TEST_F(DynamicConvexHullTest, IntegerLimits) {
+    DynamicConvexHull<int> dynamicHull;
+    MonotoneChainAlgorithm<int> recompute;
+    std::vector<Point<int>> live = {
+        Point<int>(INT_MIN, 0), Point<int>(0, INT_MIN), Point<int>(10, 10), Point<int>(0, 5)
+    };
+    for (const Point<int>& point : live) {
+        dynamicHull.insert(point);
+    }
+    ASSERT_TRUE(sameVertexes(dynamicHull.hull(), recompute.apply(live)));
+    EXPECT_EQ(dynamicHull.hull().numVertexes(), 3u);
+
+    // Coordinates drawn from the extremes of int, with erasures
+    std::mt19937 gen(13);
+    const int values[] = {INT_MIN, INT_MIN + 1, -1, 0, 1, INT_MAX - 1, INT_MAX};
+    for (int step = 0; step < 1000; ++step) {
+        if (!live.empty() && gen() % 3 == 0) {
+            size_t index = gen() % live.size();
+            EXPECT_TRUE(dynamicHull.erase(live[index]));
+            live.erase(live.begin() + index);
+        } else {
+            Point<int> point(values[gen() % 7], values[gen() % 7]);
+            dynamicHull.insert(point);
+            live.push_back(point);
+        }
+
+        if (live.size() >= 3) {
+            ASSERT_TRUE(sameVertexes(dynamicHull.hull(), recompute.apply(live))) << "step " << step;
+        }
+    }
+}
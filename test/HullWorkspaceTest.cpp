@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "ConvexHullStrategy/HullWorkspace/HullWorkspace.h"
+#include "ConvexHullStrategy/GiftWrappingAlgorithm/GiftWrappingAlgorithm.h"
+#include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+// Every allocation in this test binary goes through here, so a test can count the ones made
+// between two points. The binary is kept apart from run_tests, and every form of new and
+// delete is replaced so that allocations and releases always pair malloc with free
+static std::atomic<size_t> allocationCount{0};
+
+static void* countedAllocation(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+static void* countedAlignedAllocation(size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size_t align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+    return std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align);
+}
+
+void* operator new(size_t size) {
+    if (void* memory = countedAllocation(size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocation(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocation(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* memory = countedAlignedAllocation(size, alignment)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlignedAllocation(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlignedAllocation(size, alignment);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+
+class HullWorkspaceTest : public ::testing::Test {
+protected:
+    std::vector<Point<double>> cloud;
+    std::vector<Point<double>> smallerCloud;
+
+    void SetUp() override {
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+        for (int i = 0; i < 2000; i++) {
+            cloud.emplace_back(coordinate(gen), coordinate(gen));
+        }
+        smallerCloud.assign(cloud.begin(), cloud.begin() + 700);
+    }
+
+    // Allocations made by applyInto() once the buffers have seen the largest cloud
+    size_t steadyStateAllocations(AConvexHullStrategy<double>& strategy) {
+        std::vector<Point<double>> hull;
+        strategy.applyInto(cloud, hull);
+
+        size_t before = allocationCount.load();
+        for (int round = 0; round < 5; round++) {
+            strategy.applyInto(smallerCloud, hull);
+            strategy.applyInto(cloud, hull);
+        }
+        return allocationCount.load() - before;
+    }
+
+    void expectSameVertexes(const std::vector<Point<double>>& hull, const Poligon<double>& expected) {
+        ASSERT_EQ(hull.size(), expected.numVertexes());
+        for (size_t i = 0; i < hull.size(); i++) {
+            EXPECT_EQ(hull[i], expected[i]);
+        }
+    }
+};
+
+TEST_F(HullWorkspaceTest, GiftWrappingSteadyStateDoesNotAllocate) {
+    GiftWrappingAlgorithm<double> giftWrap;
+    EXPECT_EQ(steadyStateAllocations(giftWrap), 0u);
+}
+
+TEST_F(HullWorkspaceTest, DivideAndConquerSteadyStateDoesNotAllocate) {
+    DivideAndConquerAlgorithm<double> divideConquer;
+    EXPECT_EQ(steadyStateAllocations(divideConquer), 0u);
+}
+
+TEST_F(HullWorkspaceTest, SharedWorkspaceGivesSameHulls) {
+    HullWorkspace<double> shared;
+    GiftWrappingAlgorithm<double> giftWrap;
+    DivideAndConquerAlgorithm<double> divideConquer;
+    giftWrap.shareWorkspace(shared);
+    divideConquer.shareWorkspace(shared);
+
+    std::vector<Point<double>> hull;
+    divideConquer.applyInto(cloud, hull);
+    expectSameVertexes(hull, DivideAndConquerAlgorithm<double>().apply(cloud));
+    giftWrap.applyInto(smallerCloud, hull);
+    expectSameVertexes(hull, GiftWrappingAlgorithm<double>().apply(smallerCloud));
+    divideConquer.applyInto(smallerCloud, hull);
+    expectSameVertexes(hull, DivideAndConquerAlgorithm<double>().apply(smallerCloud));
+}
+
+TEST_F(HullWorkspaceTest, DefaultApplyIntoCopiesApply) {
+    MonotoneChainAlgorithm<double> monotoneChain;
+    std::vector<Point<double>> hull = {Point<double>(1.0, 1.0)};
+    monotoneChain.applyInto(cloud, hull);
+    expectSameVertexes(hull, monotoneChain.apply(cloud));
+}
+
+TEST_F(HullWorkspaceTest, MovedStrategiesUseTheirOwnWorkspace) {
+    static_assert(!std::is_copy_constructible_v<GiftWrappingAlgorithm<double>>);
+    static_assert(!std::is_copy_constructible_v<DivideAndConquerAlgorithm<double>>);
+
+    // The originals and their workspaces are gone before the moved strategies run again
+    std::vector<Point<double>> hull;
+    auto giftWrap = std::make_unique<GiftWrappingAlgorithm<double>>();
+    auto divideConquer = std::make_unique<DivideAndConquerAlgorithm<double>>();
+    giftWrap->applyInto(cloud, hull);
+    divideConquer->applyInto(cloud, hull);
+    GiftWrappingAlgorithm<double> movedGiftWrap(std::move(*giftWrap));
+    DivideAndConquerAlgorithm<double> movedDivideConquer;
+    movedDivideConquer = std::move(*divideConquer);
+    giftWrap.reset();
+    divideConquer.reset();
+
+    movedGiftWrap.applyInto(smallerCloud, hull);
+    expectSameVertexes(hull, GiftWrappingAlgorithm<double>().apply(smallerCloud));
+    movedDivideConquer.applyInto(smallerCloud, hull);
+    expectSameVertexes(hull, DivideAndConquerAlgorithm<double>().apply(smallerCloud));
+
+    // A shared workspace stays shared
+    HullWorkspace<double> shared;
+    DivideAndConquerAlgorithm<double> sharing;
+    sharing.shareWorkspace(shared);
+    DivideAndConquerAlgorithm<double> movedSharing(std::move(sharing));
+    movedSharing.applyInto(cloud, hull);
+    EXPECT_EQ(shared.points.size(), cloud.size());
+}
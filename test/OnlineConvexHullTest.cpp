@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "DynamicHull/OnlineConvexHull/OnlineConvexHull.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+class OnlineConvexHullTest : public ::testing::Test {
+protected:
+    OnlineConvexHull<double> hull;
+
+    std::vector<Point<double>> squareWithInterior = {
+        Point<double>(0.0, 0.0),
+        Point<double>(4.0, 0.0),
+        Point<double>(4.0, 4.0),
+        Point<double>(0.0, 4.0),
+        Point<double>(2.0, 2.0),
+        Point<double>(1.0, 3.0),
+        Point<double>(2.0, 0.0)   // on an edge
+    };
+};
+
+TEST_F(OnlineConvexHullTest, Empty) {
+    EXPECT_EQ(hull.numVertexes(), 0);
+    EXPECT_EQ(hull.hull().numVertexes(), 0);
+    EXPECT_FALSE(hull.contains(Point<double>(0.0, 0.0)));
+}
+
+TEST_F(OnlineConvexHullTest, RejectsInteriorAndBoundaryPoints) {
+    size_t accepted = hull.insert(squareWithInterior);
+
+    EXPECT_EQ(accepted, 4);
+    EXPECT_EQ(hull.numProcessed(), 7);
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_TRUE(hull.contains(Point<double>(3.0, 1.0)));
+    EXPECT_FALSE(hull.insert(Point<double>(3.0, 1.0)));
+
+    Poligon<double> result = hull.hull();
+    EXPECT_DOUBLE_EQ(result.area(), 16.0);
+    EXPECT_TRUE(result.isCCW());
+}
+
+TEST_F(OnlineConvexHullTest, OuterPointEvictsVertexes) {
+    hull.insert(squareWithInterior);
+
+    EXPECT_TRUE(hull.insert(Point<double>(8.0, 2.0)));
+    EXPECT_EQ(hull.numVertexes(), 5);
+
+    // Swallows the whole square
+    EXPECT_TRUE(hull.insert(Point<double>(-10.0, -10.0)));
+    EXPECT_TRUE(hull.insert(Point<double>(10.0, 10.0)));
+    EXPECT_TRUE(hull.insert(Point<double>(-10.0, 10.0)));
+    EXPECT_TRUE(hull.insert(Point<double>(10.0, -10.0)));
+    EXPECT_EQ(hull.numVertexes(), 4);
+    EXPECT_DOUBLE_EQ(hull.hull().area(), 400.0);
+}
+
+TEST_F(OnlineConvexHullTest, MatchesBatchHullOnStream) {
+    // A small integer grid produces plenty of collinear and repeated points
+    std::mt19937 gen(11);
+    OnlineConvexHull<int> online;
+    MonotoneChainAlgorithm<int> batch;
+    std::vector<Point<int>> seen;
+
+    for (int step = 0; step < 2000; ++step) {
+        Point<int> point(static_cast<int>(gen() % 40), static_cast<int>(gen() % 40));
+        online.insert(point);
+        seen.push_back(point);
+
+        if (seen.size() >= 3) {
+            Poligon<int> expected = batch.apply(seen);
+            Poligon<int> actual = online.hull();
+            ASSERT_EQ(actual.numVertexes(), expected.numVertexes()) << "step " << step;
+            for (size_t i = 0; i < actual.numVertexes(); ++i) {
+                ASSERT_EQ(actual[i], expected[i]) << "step " << step;
+            }
+        }
+    }
+}
+
+TEST_F(OnlineConvexHullTest, IntegerLimits) {
+    OnlineConvexHull<int> online;
+    MonotoneChainAlgorithm<int> batch;
+    std::vector<Point<int>> seen = {
+        Point<int>(INT_MIN, 0), Point<int>(0, INT_MIN), Point<int>(10, 10), Point<int>(0, 5)
+    };
+    online.insert(seen);
+    EXPECT_EQ(online.hull().numVertexes(), 3u);
+    EXPECT_TRUE(online.contains(Point<int>(0, 5)));
+
+    // Coordinates drawn from the extremes of int
+    std::mt19937 gen(17);
+    const int values[] = {INT_MIN, INT_MIN + 1, -1, 0, 1, INT_MAX - 1, INT_MAX};
+    for (int step = 0; step < 500; ++step) {
+        Point<int> point(values[gen() % 7], values[gen() % 7]);
+        online.insert(point);
+        seen.push_back(point);
+
+        Poligon<int> expected = batch.apply(seen);
+        Poligon<int> actual = online.hull();
+        ASSERT_EQ(actual.numVertexes(), expected.numVertexes()) << "step " << step;
+        for (size_t i = 0; i < actual.numVertexes(); ++i) {
+            ASSERT_EQ(actual[i], expected[i]) << "step " << step;
+        }
+    }
+}
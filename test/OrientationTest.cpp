@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include "Point/Point.h"
 #include "ConvexHullStrategy/Orientation.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
 
 class OrientationTest : public ::testing::Test {
 protected:
@@ -15,3 +20,59 @@ TEST_F(OrientationTest, OrientationValues) {
     EXPECT_EQ(static_cast<int>(Orientation::CLOCKWISE), 1);
     EXPECT_EQ(static_cast<int>(Orientation::COUNTERCLOCKWISE), 2);
 }
+
+TEST_F(OrientationTest, PredicateBasicTurns) {
+    EXPECT_EQ(OrientationPredicate<double>::orientation(origin, right, up), Orientation::COUNTERCLOCKWISE);
+    EXPECT_EQ(OrientationPredicate<double>::orientation(origin, up, right), Orientation::CLOCKWISE);
+    EXPECT_EQ(OrientationPredicate<double>::orientation(origin, upRight, Point<double>(2.0, 2.0)), Orientation::COLLINEAR);
+    
+    EXPECT_EQ(OrientationPredicate<int>::sign(0, 0, 1, 0, 0, 1), 1);
+    EXPECT_EQ(OrientationPredicate<int>::sign(0, 0, 0, 1, 1, 0), -1);
+    EXPECT_EQ(OrientationPredicate<float>::sign(0.0f, 0.0f, 1.0f, 1.0f, 3.0f, 3.0f), 0);
+}
+
+TEST_F(OrientationTest, PredicateIntegerExtremes) {
+    // Differences and products overflow 32 and 64 bits respectively
+    const int lo = std::numeric_limits<int>::min();
+    const int hi = std::numeric_limits<int>::max();
+    EXPECT_EQ(OrientationPredicate<int>::sign(lo, lo, hi, lo, lo, hi), 1);
+    EXPECT_EQ(OrientationPredicate<int>::sign(lo, lo, hi, hi, hi - 1, hi), 1);
+    EXPECT_EQ(OrientationPredicate<int>::sign(lo, lo, hi, hi, hi, hi - 1), -1);
+    EXPECT_EQ(OrientationPredicate<int>::sign(lo, lo, 0, 0, hi, hi), 0);
+}
+
+TEST_F(OrientationTest, PredicateNearCollinearMatchesExact) {
+    // Integer-valued doubles around 2^40 make the products lose bits; __int128 is the reference
+    std::mt19937_64 gen(7);
+    std::uniform_int_distribution<int64_t> base(-(int64_t(1) << 40), int64_t(1) << 40);
+    std::uniform_int_distribution<int64_t> step(-(int64_t(1) << 20), int64_t(1) << 20);
+    std::uniform_int_distribution<int64_t> nudge(-1, 1);
+    
+    OrientationPredicate<double>::resetSlowPathCount();
+    for (int i = 0; i < 2000; i++) {
+        int64_t ax = base(gen), ay = base(gen);
+        int64_t dx = step(gen), dy = step(gen);
+        int64_t bx = ax + 1000 * dx, by = ay + 1000 * dy;
+        int64_t cx = ax + 999 * dx + nudge(gen), cy = ay + 999 * dy + nudge(gen);
+        
+        __int128 det = __int128(bx - ax) * (cy - ay) - __int128(by - ay) * (cx - ax);
+        int expected = (det > 0) - (det < 0);
+        EXPECT_EQ(OrientationPredicate<double>::sign(double(ax), double(ay), double(bx), double(by),
+                                                     double(cx), double(cy)), expected);
+    }
+    EXPECT_GT(OrientationPredicate<double>::slowPathCount(), 0u);
+}
+
+TEST_F(OrientationTest, PredicateSlowPathCounter) {
+    OrientationPredicate<double>::resetSlowPathCount();
+    // Clear turns are settled by the filter; exact zeros from axis-aligned points need no fallback
+    OrientationPredicate<double>::orientation(origin, right, up);
+    OrientationPredicate<double>::orientation(origin, up, upRight);
+    OrientationPredicate<double>::orientation(origin, right, Point<double>(2.0, 0.0));
+    EXPECT_EQ(OrientationPredicate<double>::slowPathCount(), 0u);
+    
+    // Consecutive doubles near 0.5 against far points on the diagonal (Kettner et al.)
+    double x = std::nextafter(0.5, 1.0);
+    OrientationPredicate<double>::sign(x, 0.5, 12.0, 12.0, 24.0, 24.0);
+    EXPECT_EQ(OrientationPredicate<double>::slowPathCount(), 1u);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "OutOfCore/OutOfCoreHull/OutOfCoreHull.h"
+#include "PointCloudIO/PointCloudFile/PointCloudFile.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+class OutOfCoreHullTest : public ::testing::Test {
+protected:
+    MonotoneChainAlgorithm<double> monotoneChain;
+    // One file per test, since ctest runs the tests of this fixture as concurrent processes
+    std::string path = ::testing::TempDir() + "out_of_core_hull_test_" +
+                       ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    void writeRecords(const std::vector<Point<double>>& points, size_t extraBytes = 0) {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        for (const auto& point : points) {
+            double record[2] = {point.getX(), point.getY()};
+            std::fwrite(record, sizeof(record), 1, file);
+        }
+        for (size_t i = 0; i < extraBytes; i++) {
+            std::fputc(0, file);
+        }
+        std::fclose(file);
+    }
+};
+
+TEST_F(OutOfCoreHullTest, MatchesInMemoryHull) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 10007; i++) {
+        points.emplace_back(coordinate(gen), coordinate(gen));
+    }
+    writeRecords(points);
+
+    // 333 records per chunk puts most windows off page boundaries
+    OutOfCoreHull<double> driver(monotoneChain, 333);
+    Poligon<double> hull({});
+    ASSERT_TRUE(driver.apply(path, hull));
+    Poligon<double> expected = monotoneChain.apply(points);
+
+    EXPECT_EQ(driver.lastPointCount(), 10007u);
+    EXPECT_EQ(driver.lastChunkCount(), 31u);
+    ASSERT_EQ(hull.numVertexes(), expected.numVertexes());
+    for (size_t i = 0; i < hull.numVertexes(); i++) {
+        EXPECT_EQ(hull[i], expected[i]);
+    }
+}
+
+TEST_F(OutOfCoreHullTest, EmptyFile) {
+    writeRecords({});
+
+    OutOfCoreHull<double> driver(monotoneChain);
+    Poligon<double> hull({Point<double>(1.0, 1.0)});
+    ASSERT_TRUE(driver.apply(path, hull));
+    EXPECT_EQ(hull.numVertexes(), 0u);
+    EXPECT_EQ(driver.lastChunkCount(), 0u);
+}
+
+TEST_F(OutOfCoreHullTest, RejectsUnreadableOrTruncatedFiles) {
+    OutOfCoreHull<double> driver(monotoneChain);
+    Poligon<double> hull({Point<double>(1.0, 1.0)});
+    EXPECT_FALSE(driver.apply(path + ".missing", hull));
+
+    writeRecords({Point<double>(0.0, 0.0), Point<double>(1.0, 0.0), Point<double>(0.0, 1.0)}, 5);
+    EXPECT_FALSE(driver.apply(path, hull));
+    EXPECT_EQ(hull.numVertexes(), 1u);
+}
+
+TEST_F(OutOfCoreHullTest, ReadsPointCloudFileColumns) {
+    std::mt19937 gen(12);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 10007; i++) {
+        points.emplace_back(coordinate(gen), coordinate(gen));
+    }
+    ASSERT_TRUE(PointCloudFile<double>::write(path, points));
+
+    OutOfCoreHull<double> driver(monotoneChain, 333);
+    Poligon<double> hull({Point<double>(1.0, 1.0)});
+    PointCloudFile<double> file;
+    EXPECT_FALSE(driver.apply(file, hull));
+    EXPECT_EQ(hull.numVertexes(), 1u);
+
+    ASSERT_TRUE(file.open(path));
+    ASSERT_TRUE(driver.apply(file, hull));
+    Poligon<double> expected = monotoneChain.apply(points);
+
+    EXPECT_EQ(driver.lastPointCount(), 10007u);
+    EXPECT_EQ(driver.lastChunkCount(), 31u);
+    ASSERT_EQ(hull.numVertexes(), expected.numVertexes());
+    for (size_t i = 0; i < hull.numVertexes(); i++) {
+        EXPECT_EQ(hull[i], expected[i]);
+    }
+}
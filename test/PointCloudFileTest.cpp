@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "PointCloudIO/PointCloudFile/PointCloudFile.h"
+
+class PointCloudFileTest : public ::testing::Test {
+protected:
+    // One file per test, since ctest runs the tests of this fixture as concurrent processes
+    std::string path = ::testing::TempDir() + "point_cloud_file_test_" +
+                       ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".gcl";
+
+    std::vector<Point<double>> cloud = {
+        Point<double>(0.5, -1.0),
+        Point<double>(3.0, 2.25),
+        Point<double>(-7.0, 4.0),
+        Point<double>(1e9, 1e-9),
+        Point<double>(0.0, 0.0)
+    };
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+};
+
+TEST_F(PointCloudFileTest, RoundTripsColumns) {
+    ASSERT_TRUE(PointCloudFile<double>::write(path, cloud));
+
+    PointCloudFile<double> file;
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.size(), cloud.size());
+    EXPECT_EQ(file.dimension(), 2u);
+    EXPECT_EQ(file.kind(), PointSetKind::CLOUD);
+    // Columns come straight from the page-aligned mapping, each on a cache line boundary
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(file.column(0)) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(file.column(1)) % 64, 0u);
+    for (size_t i = 0; i < cloud.size(); i++) {
+        EXPECT_EQ(file.column(0)[i], cloud[i].getX());
+        EXPECT_EQ(file.column(1)[i], cloud[i].getY());
+    }
+    EXPECT_EQ(file.points(), cloud);
+}
+
+TEST_F(PointCloudFileTest, ThreeDimensionsAndOtherScalarTypes) {
+    std::vector<Point3<float>> points = {Point3<float>(1.0f, 2.0f, 3.0f), Point3<float>(-4.0f, 5.5f, -6.0f)};
+    ASSERT_TRUE(PointCloudFile<float>::write(path, points));
+    PointCloudFile<float> floats;
+    ASSERT_TRUE(floats.open(path));
+    EXPECT_EQ(floats.dimension(), 3u);
+    EXPECT_EQ(floats.point3(1).getZ(), -6.0f);
+    EXPECT_TRUE(floats.point(1) == Point<float>(-4.0f, 5.5f));
+
+    // The header records the scalar type, so a reader of another type refuses the file
+    PointCloudFile<double> doubles;
+    EXPECT_FALSE(doubles.open(path));
+    EXPECT_FALSE(doubles.isOpen());
+
+    std::vector<Point<int>> ints = {Point<int>(-2147483647, 2147483647)};
+    ASSERT_TRUE(PointCloudFile<int>::write(path, ints));
+    PointCloudFile<int> intFile;
+    ASSERT_TRUE(intFile.open(path));
+    EXPECT_EQ(intFile.point(0), ints[0]);
+}
+
+TEST_F(PointCloudFileTest, HullKindAndEmptyFiles) {
+    Poligon<double> hull({Point<double>(0.0, 0.0), Point<double>(1.0, 0.0), Point<double>(0.0, 1.0)});
+    ASSERT_TRUE(PointCloudFile<double>::write(path, hull));
+    PointCloudFile<double> file;
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.kind(), PointSetKind::HULL);
+    EXPECT_EQ(file.size(), 3u);
+
+    ASSERT_TRUE(PointCloudFile<double>::write(path, std::vector<Point<double>>()));
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_TRUE(file.points().empty());
+}
+
+TEST_F(PointCloudFileTest, RejectsForeignAndTruncatedFiles) {
+    PointCloudFile<double> file;
+    EXPECT_FALSE(file.open(path + ".missing"));
+
+    FILE* foreign = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(foreign, nullptr);
+    std::vector<char> text(200, 'x');
+    std::fwrite(text.data(), 1, text.size(), foreign);
+    std::fclose(foreign);
+    EXPECT_FALSE(file.open(path));
+
+    // Drop the padded y block so the header promises more than the file holds
+    ASSERT_TRUE(PointCloudFile<double>::write(path, cloud));
+    ASSERT_EQ(truncate(path.c_str(), 64 + 64), 0);
+    EXPECT_FALSE(file.open(path));
+}
+
+TEST_F(PointCloudFileTest, RejectsUnknownKind) {
+    ASSERT_TRUE(PointCloudFile<double>::write(path, cloud));
+
+    // kind follows the magic, the version, the scalar type and the dimension
+    FILE* patched = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(patched, nullptr);
+    ASSERT_EQ(std::fseek(patched, 12, SEEK_SET), 0);
+    std::fputc(7, patched);
+    std::fclose(patched);
+
+    PointCloudFile<double> file;
+    EXPECT_FALSE(file.open(path));
+    EXPECT_FALSE(file.isOpen());
+}
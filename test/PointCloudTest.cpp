@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "PointCloud/PointCloud.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/DivideAndConquerAlgorithm/DivideAndConquerAlgorithm.h"
+#include "PointGenerationStrategy/RandomPointStrategy/RandomPointStrategy.h"
+
+class PointCloudTest : public ::testing::Test {
+protected:
+    std::vector<Point<double>> points;
+
+    void SetUp() override {
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<double> coordinate(-50.0, 50.0);
+        for (int i = 0; i < 1000; i++) {
+            points.emplace_back(coordinate(gen), coordinate(gen));
+        }
+    }
+
+    void expectAligned(const PointCloud<double>& cloud) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.xs()) % PointCloud<double>::ALIGNMENT, 0u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.ys()) % PointCloud<double>::ALIGNMENT, 0u);
+    }
+};
+
+TEST_F(PointCloudTest, RoundTripsThroughPoints) {
+    PointCloud<double> cloud(points);
+    ASSERT_EQ(cloud.size(), points.size());
+    expectAligned(cloud);
+    EXPECT_EQ(cloud.zs(), nullptr);
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(cloud.xs()[i], points[i].getX());
+        EXPECT_EQ(cloud.ys()[i], points[i].getY());
+    }
+
+    std::vector<Point<double>> back = cloud.toPoints();
+    ASSERT_EQ(back.size(), points.size());
+    size_t i = 0;
+    for (Point<double> point : cloud) {
+        EXPECT_TRUE(point == points[i]);
+        EXPECT_TRUE(back[i] == points[i]);
+        i++;
+    }
+    EXPECT_EQ(i, points.size());
+}
+
+TEST_F(PointCloudTest, GrowsKeepingColumnsAligned) {
+    PointCloud<double> cloud;
+    for (const Point<double>& point : points) {
+        ASSERT_TRUE(cloud.push_back(point));
+    }
+    expectAligned(cloud);
+    ASSERT_EQ(cloud.size(), points.size());
+    EXPECT_GE(cloud.capacity(), cloud.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_TRUE(cloud[i] == points[i]);
+    }
+
+    ASSERT_TRUE(cloud.resize(points.size() + 3));
+    EXPECT_EQ(cloud.xs()[points.size() + 2], 0.0);
+    EXPECT_EQ(cloud.ys()[points.size() + 2], 0.0);
+
+    PointCloud<double> moved(std::move(cloud));
+    EXPECT_EQ(moved.size(), points.size() + 3);
+    EXPECT_TRUE(moved[0] == points[0]);
+    EXPECT_TRUE(cloud.empty());
+}
+
+TEST_F(PointCloudTest, StoresZInDimensionThree) {
+    std::vector<Point3<int>> spatial = {Point3<int>(1, 2, 3), Point3<int>(-4, 5, -6)};
+    PointCloud<int> cloud(spatial);
+    EXPECT_EQ(cloud.dimension(), 3u);
+    ASSERT_NE(cloud.zs(), nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.zs()) % PointCloud<int>::ALIGNMENT, 0u);
+    EXPECT_EQ(cloud.zs()[1], -6);
+    EXPECT_TRUE(cloud.point3(0) == spatial[0]);
+    EXPECT_TRUE(cloud[1] == Point<int>(-4, 5));
+}
+
+// Whether huge pages are reserved depends on the machine; either way the cloud must work
+TEST_F(PointCloudTest, HugePagesFallBackTransparently) {
+    PointCloud<double> cloud(points, 2, true);
+    ASSERT_EQ(cloud.size(), points.size());
+    expectAligned(cloud);
+    EXPECT_TRUE(cloud[points.size() - 1] == points.back());
+}
+
+TEST_F(PointCloudTest, StrategiesAndGeneratorsUseClouds) {
+    PointCloud<double> cloud;
+    RandomPointGenerator<double> generator;
+    ASSERT_TRUE(generator.generateInto(cloud, 3000));
+    ASSERT_EQ(cloud.size(), 3000u);
+
+    std::vector<Point<double>> asPoints = cloud.toPoints();
+    MonotoneChainAlgorithm<double> monotone;
+    DivideAndConquerAlgorithm<double> divideConquer;
+    Poligon<double> expected = monotone.apply(asPoints);
+    Poligon<double> fromColumns = monotone.applyCloud(cloud);
+    Poligon<double> fromDefault = divideConquer.applyCloud(cloud);
+
+    ASSERT_EQ(fromColumns.numVertexes(), expected.numVertexes());
+    ASSERT_EQ(fromDefault.numVertexes(), expected.numVertexes());
+    for (size_t i = 0; i < expected.numVertexes(); i++) {
+        EXPECT_TRUE(fromColumns[i] == expected[i]);
+        EXPECT_TRUE(fromDefault[i] == expected[i]);
+    }
+}
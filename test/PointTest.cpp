@@ -1,11 +1,13 @@
 #include <gtest/gtest.h>
+#include <cmath>
 #include <sstream>
+#include <type_traits>
 #include "Point/Point.h"
 
 class PointTest : public ::testing::Test {
 protected:
     Point<double> p1{1.0, 2.0};
-    Point<double> p2{3.0, 4.0, 5.0};
+    Point3<double> p2{3.0, 4.0, 5.0};
     Point<int> pi{1, 2};
 };
 
@@ -37,13 +39,14 @@ TEST_F(PointTest, Distance) {
 TEST_F(PointTest, EqualityOperator) {
     Point<double> p3(1.0, 2.0);
     EXPECT_TRUE(p1 == p3);
-    EXPECT_FALSE(p1 == p2);
+    EXPECT_FALSE(p1 == Point<double>(1.0, 3.0));
+    EXPECT_FALSE(p2 == Point3<double>(3.0, 4.0));
 }
 
 TEST_F(PointTest, OutputOperator) {
     std::ostringstream oss;
-    oss << p1;
-    EXPECT_EQ(oss.str(), "(1, 2, 0)");
+    oss << p1 << " " << p2;
+    EXPECT_EQ(oss.str(), "(1, 2, 0) (3, 4, 5)");
 }
 
 TEST_F(PointTest, IntegerType) {
@@ -51,3 +54,19 @@ TEST_F(PointTest, IntegerType) {
     EXPECT_EQ(pi.getY(), 2);
     EXPECT_EQ(pi.getZ(), 0);
 }
+
+TEST_F(PointTest, ConstexprAndTriviallyCopyable) {
+    constexpr Point<int> a(3, 4);
+    constexpr Point<int> b = a;
+    static_assert(b.getX() == 3 && b.getY() == 4 && b.getZ() == 0);
+    static_assert(a == b);
+    EXPECT_TRUE(std::is_trivially_copyable_v<Point<float>>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<Point<int>>);
+}
+
+TEST_F(PointTest, PlanarPointsStoreNoZ) {
+    EXPECT_EQ(sizeof(Point<double>), 2 * sizeof(double));
+    EXPECT_EQ(sizeof(Point3<double>), 3 * sizeof(double));
+    EXPECT_DOUBLE_EQ(Point<double>(0.0, 0.0).dist(Point<double>(3.0, 4.0)), 5.0);
+    EXPECT_DOUBLE_EQ(Point3<double>(0.0, 0.0, 0.0).dist(p2), std::sqrt(50.0));
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <sstream>
+#include <cmath>
+#include <utility>
 #include "Point/Point.h"
 #include "Poligon/Poligon.h"
 
@@ -92,3 +94,80 @@ TEST_F(PolygonTest, IntegerPolygon) {
     Poligon<int> poly(int_square);
     EXPECT_EQ(poly.area(), 4);
 }
+
+TEST_F(PolygonTest, IntegerPolygonLargeCoordinates) {
+    // The shoelace terms overflow int although the area itself fits
+    std::vector<Point<int>> int_square = {
+        Point<int>(0, 0),
+        Point<int>(40000, 0),
+        Point<int>(40000, 40000),
+        Point<int>(0, 40000)
+    };
+    Poligon<int> poly(int_square);
+    EXPECT_TRUE(poly.isCCW());
+    EXPECT_EQ(poly.area(), 1600000000);
+}
+
+TEST_F(PolygonTest, DerivedProperties) {
+    Poligon<double> poly(triangle);
+    EXPECT_DOUBLE_EQ(poly.signedArea(), 2.0);
+    EXPECT_TRUE(poly.isConvex());
+    EXPECT_DOUBLE_EQ(poly.perimeter(), 2.0 + 2.0 * std::sqrt(5.0));
+    EXPECT_DOUBLE_EQ(poly.centroid().getX(), 1.0);
+    EXPECT_DOUBLE_EQ(poly.centroid().getY(), 2.0 / 3.0);
+
+    const Poligon<double>::Bounds& box = poly.bounds();
+    EXPECT_DOUBLE_EQ(box.minX, 0.0);
+    EXPECT_DOUBLE_EQ(box.minY, 0.0);
+    EXPECT_DOUBLE_EQ(box.maxX, 2.0);
+    EXPECT_DOUBLE_EQ(box.maxY, 2.0);
+
+    // Integer polygons report perimeter and centroid in double
+    Poligon<int> unit({Point<int>(0, 0), Point<int>(1, 0), Point<int>(1, 1), Point<int>(0, 1)});
+    EXPECT_DOUBLE_EQ(unit.perimeter(), 4.0);
+    EXPECT_DOUBLE_EQ(unit.centroid().getX(), 0.5);
+    EXPECT_DOUBLE_EQ(unit.centroid().getY(), 0.5);
+}
+
+TEST_F(PolygonTest, CachedPropertiesFollowReversal) {
+    Poligon<double> poly(clockwise_square);
+    EXPECT_DOUBLE_EQ(poly.signedArea(), -1.0);
+    EXPECT_DOUBLE_EQ(poly.perimeter(), 4.0);
+    EXPECT_FALSE(poly.isCCW());
+
+    poly.fromCWToCCW();
+    EXPECT_TRUE(poly.isCCW());
+    EXPECT_DOUBLE_EQ(poly.signedArea(), 1.0);
+    EXPECT_DOUBLE_EQ(poly.area(), 1.0);
+    EXPECT_DOUBLE_EQ(poly.perimeter(), 4.0);
+    EXPECT_DOUBLE_EQ(poly.centroid().getX(), 0.5);
+    EXPECT_TRUE(poly[0] == Point<double>(1.0, 0.0));
+}
+
+TEST_F(PolygonTest, ConvexityDetection) {
+    std::vector<Point<double>> dart = {
+        Point<double>(0.0, 0.0), Point<double>(2.0, 1.0), Point<double>(4.0, 0.0), Point<double>(2.0, 3.0)
+    };
+    EXPECT_FALSE(Poligon<double>(dart).isConvex());
+    EXPECT_TRUE(Poligon<double>(clockwise_square).isConvex());
+
+    // Every turn is a left turn, but the boundary winds around twice
+    std::vector<Point<double>> pentagram = {
+        Point<double>(0.0, 10.0), Point<double>(-5.9, -8.1), Point<double>(9.5, 3.1),
+        Point<double>(-9.5, 3.1), Point<double>(5.9, -8.1)
+    };
+    EXPECT_FALSE(Poligon<double>(pentagram).isConvex());
+}
+
+TEST_F(PolygonTest, ConvexCCWFlagSkipsOrientationPass) {
+    std::vector<Point<double>> vertexes = square;
+    Poligon<double> hull(std::move(vertexes), true);
+    EXPECT_TRUE(hull.isCCW());
+    EXPECT_TRUE(hull.isConvex());
+    EXPECT_DOUBLE_EQ(hull.area(), 1.0);
+
+    // A flagged hull of collinear points has no interior
+    Poligon<double> segment({Point<double>(0.0, 0.0), Point<double>(1.0, 1.0)}, true);
+    EXPECT_FALSE(segment.isCCW());
+    EXPECT_TRUE(segment.isConvex());
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "HullMeasures/RotatingCalipers/RotatingCalipers.h"
+#include "ConvexHullStrategy/GiftWrappingAlgorithm/GiftWrappingAlgorithm.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+#include "ConvexHullStrategy/OrientationPredicate/OrientationPredicate.h"
+
+class RotatingCalipersTest : public ::testing::Test {
+protected:
+    // The O(h^2) measures the calipers replace: every pair for the diameter, every vertex
+    // against every edge for the width and the rectangles
+    struct BruteForce {
+        double squaredDiameter = 0.0;
+        double width = 0.0;
+        double area = 0.0;
+        double perimeter = 0.0;
+    };
+
+    template <typename T>
+    BruteForce bruteForce(const Poligon<T>& hull) {
+        using Predicate = OrientationPredicate<T>;
+        BruteForce result;
+        size_t h = hull.numVertexes();
+        for (size_t i = 0; i < h; i++) {
+            for (size_t j = i + 1; j < h; j++) {
+                result.squaredDiameter = std::max(result.squaredDiameter, double(Predicate::squaredDistance(hull[i], hull[j])));
+            }
+        }
+        for (size_t i = 0; i < h; i++) {
+            const Point<T>& a = hull[i];
+            const Point<T>& b = hull[(i + 1) % h];
+            double length = std::sqrt(double(Predicate::squaredDistance(a, b)));
+            double height = 0.0, low = 0.0, high = 0.0;
+            for (size_t j = 0; j < h; j++) {
+                height = std::max(height, double(Predicate::cross(a, b, hull[j])) / length);
+                low = std::min(low, double(Predicate::dot(a, b, hull[j])) / length);
+                high = std::max(high, double(Predicate::dot(a, b, hull[j])) / length);
+            }
+            double area = (high - low) * height;
+            double perimeter = 2.0 * (high - low + height);
+            result.width = i == 0 ? height : std::min(result.width, height);
+            result.area = i == 0 ? area : std::min(result.area, area);
+            result.perimeter = i == 0 ? perimeter : std::min(result.perimeter, perimeter);
+        }
+        return result;
+    }
+
+    // Every vertex of the hull inside the rectangle, up to rounding
+    template <typename T>
+    void expectEncloses(const Poligon<T>& hull, const std::vector<Point<typename RotatingCalipers<T>::Real>>& corners) {
+        ASSERT_EQ(corners.size(), 4u);
+        for (size_t i = 0; i < hull.numVertexes(); i++) {
+            for (size_t c = 0; c < 4; c++) {
+                const auto& a = corners[c];
+                const auto& b = corners[(c + 1) % 4];
+                double cross = (double(b.getX()) - a.getX()) * (double(hull[i].getY()) - a.getY())
+                             - (double(b.getY()) - a.getY()) * (double(hull[i].getX()) - a.getX());
+                EXPECT_GE(cross, -1e-6 * (1.0 + std::abs(double(b.getX()) - a.getX()) + std::abs(double(b.getY()) - a.getY())));
+            }
+        }
+    }
+
+    template <typename T>
+    void expectMatchesBruteForce(unsigned seed, int range, int count) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(-range, range);
+        std::vector<Point<T>> cloud;
+        for (int i = 0; i < count; i++) {
+            cloud.emplace_back(T(coordinate(gen)), T(coordinate(gen)));
+        }
+        Poligon<T> hull = MonotoneChainAlgorithm<T>().apply(cloud);
+        expectMeasures(hull, bruteForce(hull));
+    }
+
+    // The calipers on hull against measures taken on the same polygon in CCW order
+    template <typename T>
+    void expectMeasures(const Poligon<T>& hull, const BruteForce& expected) {
+        double tolerance = 1e-9 * expected.squaredDiameter + 1e-9;
+
+        auto diameter = RotatingCalipers<T>::diameter(hull);
+        EXPECT_EQ(double(diameter.squaredLength), expected.squaredDiameter);
+        EXPECT_EQ(double(diameter.squaredLength), double(OrientationPredicate<T>::squaredDistance(hull[diameter.first], hull[diameter.second])));
+
+        auto width = RotatingCalipers<T>::width(hull);
+        EXPECT_NEAR(width.width, expected.width, tolerance);
+
+        auto area = RotatingCalipers<T>::minimumAreaRectangle(hull);
+        EXPECT_NEAR(area.area, expected.area, tolerance);
+        expectEncloses(hull, area.corners);
+
+        auto perimeter = RotatingCalipers<T>::minimumPerimeterRectangle(hull);
+        EXPECT_NEAR(perimeter.perimeter, expected.perimeter, tolerance);
+        EXPECT_GE(perimeter.area, area.area - tolerance);
+        expectEncloses(hull, perimeter.corners);
+    }
+};
+
+TEST_F(RotatingCalipersTest, AxisAlignedRectangle) {
+    Poligon<int> hull({Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 3), Point<int>(0, 3)});
+
+    auto diameter = RotatingCalipers<int>::diameter(hull);
+    EXPECT_EQ(double(diameter.squaredLength), 25.0);
+    EXPECT_DOUBLE_EQ(diameter.length(), 5.0);
+    EXPECT_DOUBLE_EQ(RotatingCalipers<int>::width(hull).width, 3.0);
+
+    auto rectangle = RotatingCalipers<int>::minimumAreaRectangle(hull);
+    EXPECT_DOUBLE_EQ(rectangle.area, 12.0);
+    EXPECT_DOUBLE_EQ(rectangle.perimeter, 14.0);
+    ASSERT_EQ(rectangle.corners.size(), 4u);
+    for (const Point<double>& corner : rectangle.corners) {
+        bool isVertex = false;
+        for (size_t i = 0; i < 4; i++) {
+            isVertex = isVertex || (corner.getX() == hull[i].getX() && corner.getY() == hull[i].getY());
+        }
+        EXPECT_TRUE(isVertex);
+    }
+}
+
+TEST_F(RotatingCalipersTest, RotatedSquareIsItsOwnRectangle) {
+    Poligon<double> hull({Point<double>(0.0, -1.0), Point<double>(1.0, 0.0), Point<double>(0.0, 1.0), Point<double>(-1.0, 0.0)});
+
+    EXPECT_DOUBLE_EQ(RotatingCalipers<double>::diameter(hull).length(), 2.0);
+    EXPECT_DOUBLE_EQ(RotatingCalipers<double>::width(hull).width, std::sqrt(2.0));
+    auto rectangle = RotatingCalipers<double>::minimumAreaRectangle(hull);
+    EXPECT_DOUBLE_EQ(rectangle.area, 2.0);
+    EXPECT_DOUBLE_EQ(RotatingCalipers<double>::minimumPerimeterRectangle(hull).perimeter, 4.0 * std::sqrt(2.0));
+}
+
+TEST_F(RotatingCalipersTest, DegeneratePolygons) {
+    Poligon<double> empty(std::vector<Point<double>>{});
+    EXPECT_EQ(RotatingCalipers<double>::diameter(empty).squaredLength, 0.0);
+    EXPECT_TRUE(RotatingCalipers<double>::minimumAreaRectangle(empty).corners.empty());
+
+    Poligon<double> single({Point<double>(2.0, 3.0)});
+    EXPECT_EQ(RotatingCalipers<double>::diameter(single).squaredLength, 0.0);
+    EXPECT_EQ(RotatingCalipers<double>::width(single).width, 0.0);
+    auto point = RotatingCalipers<double>::minimumAreaRectangle(single);
+    EXPECT_EQ(point.area, 0.0);
+    ASSERT_EQ(point.corners.size(), 4u);
+    EXPECT_EQ(point.corners[2], Point<double>(2.0, 3.0));
+
+    Poligon<double> segment({Point<double>(0.0, 0.0), Point<double>(3.0, 4.0)});
+    auto diameter = RotatingCalipers<double>::diameter(segment);
+    EXPECT_EQ(diameter.first, 0u);
+    EXPECT_EQ(diameter.second, 1u);
+    EXPECT_DOUBLE_EQ(diameter.length(), 5.0);
+    EXPECT_EQ(RotatingCalipers<double>::width(segment).width, 0.0);
+    auto rectangle = RotatingCalipers<double>::minimumPerimeterRectangle(segment);
+    EXPECT_DOUBLE_EQ(rectangle.area, 0.0);
+    EXPECT_DOUBLE_EQ(rectangle.perimeter, 10.0);
+}
+
+TEST_F(RotatingCalipersTest, IntegerHullsMatchBruteForce) {
+    for (unsigned seed = 0; seed < 30; seed++) {
+        expectMatchesBruteForce<int>(seed, 1000, 300);
+    }
+    // Coordinates near the int limits still compare exactly
+    expectMatchesBruteForce<int>(99, 2000000000, 200);
+}
+
+TEST_F(RotatingCalipersTest, GiftWrapAndClockwiseHulls) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    for (int round = 0; round < 30; round++) {
+        std::vector<Point<int>> cloud;
+        for (int i = 0; i < 200; i++) {
+            cloud.emplace_back(coordinate(gen), coordinate(gen));
+        }
+        Poligon<int> hull = MonotoneChainAlgorithm<int>().apply(cloud);
+        BruteForce expected = bruteForce(hull);
+        expectMeasures(GiftWrappingAlgorithm<int>().apply(cloud), expected);
+
+        std::vector<Point<int>> reversed;
+        for (size_t i = hull.numVertexes(); i-- > 0;) {
+            reversed.push_back(hull[i]);
+        }
+        Poligon<int> clockwise(reversed);
+        ASSERT_FALSE(clockwise.isCCW());
+        expectMeasures(clockwise, expected);
+
+        // Indices refer to the clockwise polygon: its edge runs backwards, so the strip is on the right
+        auto width = RotatingCalipers<int>::width(clockwise);
+        size_t h = clockwise.numVertexes();
+        const Point<int>& a = clockwise[width.edge];
+        const Point<int>& b = clockwise[(width.edge + 1) % h];
+        double height = -double(OrientationPredicate<int>::cross(a, b, clockwise[width.vertex])) /
+                        std::sqrt(double(OrientationPredicate<int>::squaredDistance(a, b)));
+        EXPECT_NEAR(height, width.width, 1e-6);
+    }
+}
+
+TEST_F(RotatingCalipersTest, FloatingHullsMatchBruteForce) {
+    for (unsigned seed = 0; seed < 30; seed++) {
+        expectMatchesBruteForce<double>(seed, 1000, 300);
+        expectMatchesBruteForce<double>(seed, 5, 40);
+    }
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "Point/Point.h"
+#include "Poligon/Poligon.h"
+#include "DynamicHull/SlidingWindowHull/SlidingWindowHull.h"
+#include "ConvexHullStrategy/MonotoneChainAlgorithm/MonotoneChainAlgorithm.h"
+
+class SlidingWindowHullTest : public ::testing::Test {
+protected:
+    std::vector<Point<double>> square = {
+        Point<double>(0.0, 0.0),
+        Point<double>(4.0, 0.0),
+        Point<double>(4.0, 4.0),
+        Point<double>(0.0, 4.0)
+    };
+};
+
+TEST_F(SlidingWindowHullTest, CountWindowDropsOldestPoints) {
+    SlidingWindowHull<double> window(3);
+    for (const Point<double>& point : square) {
+        window.push(point);
+    }
+
+    Poligon<double> result = window.hull();
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(result.numVertexes(), 3);
+    EXPECT_DOUBLE_EQ(result.area(), 8.0);
+    EXPECT_EQ(result[0], Point<double>(0.0, 4.0));
+}
+
+TEST_F(SlidingWindowHullTest, TimeWindowExpiresWithoutArrivals) {
+    SlidingWindowHull<double> window(0, 10.0);
+    for (size_t i = 0; i < square.size(); ++i) {
+        window.push(square[i], static_cast<double>(i));
+    }
+    EXPECT_EQ(window.hull().numVertexes(), 4);
+
+    // At t=12 the points stamped 0 and 1 are older than 10 seconds
+    window.expire(12.0);
+    EXPECT_EQ(window.size(), 2);
+    EXPECT_EQ(window.hull().numVertexes(), 2);
+
+    window.expire(100.0);
+    EXPECT_EQ(window.size(), 0);
+    EXPECT_EQ(window.hull().numVertexes(), 0);
+}
+
+TEST_F(SlidingWindowHullTest, MatchesRecomputationOverWindow) {
+    std::mt19937 gen(5);
+    const size_t windowSize = 50;
+    SlidingWindowHull<int> window(windowSize);
+    MonotoneChainAlgorithm<int> batch;
+    std::vector<Point<int>> stream;
+
+    for (int step = 0; step < 1000; ++step) {
+        Point<int> point(static_cast<int>(gen() % 30), static_cast<int>(gen() % 30));
+        window.push(point);
+        stream.push_back(point);
+
+        size_t begin = stream.size() > windowSize ? stream.size() - windowSize : 0;
+        std::vector<Point<int>> recent(stream.begin() + begin, stream.end());
+        if (recent.size() >= 3) {
+            Poligon<int> expected = batch.apply(recent);
+            Poligon<int> actual = window.hull();
+            ASSERT_EQ(actual.numVertexes(), expected.numVertexes()) << "step " << step;
+            for (size_t i = 0; i < actual.numVertexes(); ++i) {
+                ASSERT_EQ(actual[i], expected[i]) << "step " << step;
+            }
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <sstream>
+#include <type_traits>
 #include "Point/Point.h"
 #include "Vector/Vector.h"
 
@@ -65,3 +66,37 @@ TEST_F(VectorTest, CrossProduct) {
 TEST_F(VectorTest, GetZ) {
     EXPECT_DOUBLE_EQ(v1.getZ(), 0.0);
 }
+
+TEST_F(VectorTest, CrossProduct3D) {
+    Vector<double> x(1.0, 0.0, 0.0);
+    Vector<double> y(0.0, 1.0, 0.0);
+    EXPECT_TRUE(x.cross(y) == Vector<double>(0.0, 0.0, 1.0));
+    EXPECT_TRUE(y.cross(x) == Vector<double>(0.0, 0.0, -1.0));
+
+    Vector<double> a(1.0, 2.0, 3.0);
+    Vector<double> b(4.0, 5.0, 6.0);
+    Vector<double> c = a.cross(b);
+    EXPECT_DOUBLE_EQ(c.getX(), -3.0);
+    EXPECT_DOUBLE_EQ(c.getY(), 6.0);
+    EXPECT_DOUBLE_EQ(c.getZ(), -3.0);
+    EXPECT_DOUBLE_EQ(c.dot(a), 0.0);
+    EXPECT_DOUBLE_EQ(c.dot(b), 0.0);
+}
+
+TEST_F(VectorTest, DotProduct3D) {
+    Vector<double> a(1.0, 2.0, 3.0);
+    Vector<double> b(4.0, 5.0, 6.0);
+    EXPECT_DOUBLE_EQ(a.dot(b), 32.0);
+    std::ostringstream oss;
+    oss << a - b;
+    EXPECT_EQ(oss.str(), "Vector(-3, -3, -3)");
+}
+
+TEST_F(VectorTest, ConstexprAndTriviallyCopyable) {
+    constexpr Vector<int> a(1, 2, 3);
+    constexpr Vector<int> b(4, 5, 6);
+    static_assert(a.dot(b) == 32);
+    static_assert(a.cross(b) == Vector<int>(-3, 6, -3));
+    static_assert((a - b) * 2 == Vector<int>(-6, -6, -6));
+    EXPECT_TRUE(std::is_trivially_copyable_v<Vector<double>>);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include "ThreadPool/WorkStealingPool.h"
+
+class WorkStealingPoolTest : public ::testing::Test {
+protected:
+    WorkStealingPool pool{4};
+
+    long long fibonacci(int n) {
+        if (n < 2) return n;
+        long long a = 0;
+        long long b = 0;
+        pool.invoke([&]() { a = fibonacci(n - 1); }, [&]() { b = fibonacci(n - 2); });
+        return a + b;
+    }
+};
+
+TEST_F(WorkStealingPoolTest, NumThreads) {
+    EXPECT_EQ(pool.numThreads(), 4);
+
+    WorkStealingPool inlinePool(1);
+    EXPECT_EQ(inlinePool.numThreads(), 1);
+}
+
+TEST_F(WorkStealingPoolTest, InvokeRunsBoth) {
+    bool first = false;
+    bool second = false;
+    pool.invoke([&]() { first = true; }, [&]() { second = true; });
+
+    EXPECT_TRUE(first);
+    EXPECT_TRUE(second);
+}
+
+TEST_F(WorkStealingPoolTest, NestedInvoke) {
+    EXPECT_EQ(fibonacci(20), 6765);
+}
+
+TEST_F(WorkStealingPoolTest, ParallelForVisitsEveryIndexOnce) {
+    std::vector<std::atomic<int>> visits(10007);
+    pool.parallelFor(0, visits.size(), 64, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST_F(WorkStealingPoolTest, ParallelForEmptyRange) {
+    int calls = 0;
+    pool.parallelFor(5, 5, 1, [&](size_t, size_t) { ++calls; });
+    EXPECT_EQ(calls, 0);
+}